@@ -0,0 +1,15 @@
+// Must match SceneRenderer::layer_count
+const int layer_count = 5;
+
+layout(location = 0)
+uniform int layer;
+
+layout(location = 1)
+uniform vec4 colors[layer_count];
+
+layout(location = 0)
+out vec4 out_color;
+
+void main() {
+	out_color = colors[layer];
+}
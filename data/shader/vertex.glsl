@@ -1,6 +1,16 @@
 layout(location = 0) 
 in vec2 pos;
 
+#ifdef QUANTIZED_POSITIONS
+// Scale and offset from normalized positions to the quantization rectangle
+layout(location = 1)
+uniform vec4 pos_transform;
+#endif
+
 void main() {
+#ifdef QUANTIZED_POSITIONS
+	gl_Position = vec4(pos * pos_transform.xy + pos_transform.zw, 0.0, 1.0);
+#else
 	gl_Position = vec4(pos, 0.0, 1.0);
+#endif
 }
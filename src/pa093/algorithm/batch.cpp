@@ -0,0 +1,698 @@
+#include <pa093/algorithm/batch.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include <gsl/gsl_assert>
+
+#include <pa093/algorithm/constants.hpp>
+
+#if defined(__x86_64__) and (defined(__GNUC__) or defined(__clang__))
+#define PA093_BATCH_X86 1
+// Some GCC versions report the placeholders of the AVX-512 intrinsics as
+// uninitialized
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#include <immintrin.h>
+#pragma GCC diagnostic pop
+#define PA093_TARGET_AVX2 __attribute__((target("avx2")))
+#define PA093_TARGET_AVX512 __attribute__((target("avx512f")))
+#else
+#define PA093_BATCH_X86 0
+#endif
+
+// The vectorized kernels must round exactly like the scalar functions, so
+// multiplications and additions must not be fused
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#elif defined(__GNUC__)
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+namespace pa093::algorithm::batch
+{
+
+namespace
+{
+
+constexpr auto infinity = std::numeric_limits<float>::infinity();
+
+/**
+ * Lane indices are 32-bit
+ */
+constexpr auto max_points =
+    static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max());
+
+// Each kernel function has a scalar call operator, and one per vector width
+// that performs the same operations on every lane. The vector operators are
+// only ever called from functions of the matching target.
+
+struct Orientation
+{
+    glm::vec2 a;
+    glm::vec2 edge;
+
+    [[nodiscard]] auto operator()(glm::vec2 const p) const noexcept -> float
+    {
+        auto const d = p - a;
+        return edge.x * d.y - d.x * edge.y;
+    }
+
+#if PA093_BATCH_X86
+    PA093_TARGET_AVX2 auto operator()(__m256 const x,
+                                      __m256 const y) const noexcept -> __m256
+    {
+        auto const dx = _mm256_sub_ps(x, _mm256_set1_ps(a.x));
+        auto const dy = _mm256_sub_ps(y, _mm256_set1_ps(a.y));
+        return _mm256_sub_ps(_mm256_mul_ps(_mm256_set1_ps(edge.x), dy),
+                             _mm256_mul_ps(dx, _mm256_set1_ps(edge.y)));
+    }
+
+    PA093_TARGET_AVX512 auto operator()(__m512 const x,
+                                        __m512 const y) const noexcept
+        -> __m512
+    {
+        auto const dx = _mm512_sub_ps(x, _mm512_set1_ps(a.x));
+        auto const dy = _mm512_sub_ps(y, _mm512_set1_ps(a.y));
+        return _mm512_sub_ps(_mm512_mul_ps(_mm512_set1_ps(edge.x), dy),
+                             _mm512_mul_ps(dx, _mm512_set1_ps(edge.y)));
+    }
+#endif
+};
+
+/**
+ * Squared distance from p
+ */
+struct Distance2
+{
+    glm::vec2 p;
+
+    [[nodiscard]] auto operator()(glm::vec2 const q) const noexcept -> float
+    {
+        auto const d = q - p;
+        return d.x * d.x + d.y * d.y;
+    }
+
+#if PA093_BATCH_X86
+    PA093_TARGET_AVX2 auto operator()(__m256 const x,
+                                      __m256 const y) const noexcept -> __m256
+    {
+        auto const dx = _mm256_sub_ps(x, _mm256_set1_ps(p.x));
+        auto const dy = _mm256_sub_ps(y, _mm256_set1_ps(p.y));
+        return _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+    }
+
+    PA093_TARGET_AVX512 auto operator()(__m512 const x,
+                                        __m512 const y) const noexcept
+        -> __m512
+    {
+        auto const dx = _mm512_sub_ps(x, _mm512_set1_ps(p.x));
+        auto const dy = _mm512_sub_ps(y, _mm512_set1_ps(p.y));
+        return _mm512_add_ps(_mm512_mul_ps(dx, dx), _mm512_mul_ps(dy, dy));
+    }
+#endif
+};
+
+/**
+ * Radius of the circumcircle of (p, p1, p2), negative if the angle at p is
+ * obtuse; infinity if the points are collinear. Follows
+ * circumcircle_center() and triangulation::delaunay_distance().
+ */
+struct DelaunayDistance
+{
+    glm::vec2 p1;
+    glm::vec2 p2;
+
+    [[nodiscard]] auto operator()(glm::vec2 const p) const noexcept -> float
+    {
+        auto const ab = p1 - p;
+        auto const ac = p2 - p;
+
+        auto const det = ab.x * ac.y - ac.x * ab.y;
+        if (std::abs(det) < constants::epsilon_determinant)
+        {
+            return infinity;
+        }
+
+        auto const ab_sq = ab.x * ab.x + ab.y * ab.y;
+        auto const ac_sq = ac.x * ac.x + ac.y * ac.y;
+        auto const det2 = 2.0f * det;
+        auto const center_x = p.x + (ac.y * ab_sq - ab.y * ac_sq) / det2;
+        auto const center_y = p.y + (ab.x * ac_sq - ac.x * ab_sq) / det2;
+        auto const r = std::sqrt(Distance2{ p }({ center_x, center_y }));
+
+        return std::copysign(r, ab.x * ac.x + ab.y * ac.y);
+    }
+
+#if PA093_BATCH_X86
+    PA093_TARGET_AVX2 auto operator()(__m256 const x,
+                                      __m256 const y) const noexcept -> __m256
+    {
+        auto const sign = _mm256_set1_ps(-0.0f);
+
+        auto const abx = _mm256_sub_ps(_mm256_set1_ps(p1.x), x);
+        auto const aby = _mm256_sub_ps(_mm256_set1_ps(p1.y), y);
+        auto const acx = _mm256_sub_ps(_mm256_set1_ps(p2.x), x);
+        auto const acy = _mm256_sub_ps(_mm256_set1_ps(p2.y), y);
+
+        auto const det = _mm256_sub_ps(_mm256_mul_ps(abx, acy),
+                                       _mm256_mul_ps(acx, aby));
+        auto const degenerate =
+            _mm256_cmp_ps(_mm256_andnot_ps(sign, det),
+                          _mm256_set1_ps(constants::epsilon_determinant),
+                          _CMP_LT_OQ);
+
+        auto const ab_sq = _mm256_add_ps(_mm256_mul_ps(abx, abx),
+                                         _mm256_mul_ps(aby, aby));
+        auto const ac_sq = _mm256_add_ps(_mm256_mul_ps(acx, acx),
+                                         _mm256_mul_ps(acy, acy));
+        auto const det2 = _mm256_mul_ps(_mm256_set1_ps(2.0f), det);
+        auto const center_x = _mm256_add_ps(
+            x,
+            _mm256_div_ps(_mm256_sub_ps(_mm256_mul_ps(acy, ab_sq),
+                                        _mm256_mul_ps(aby, ac_sq)),
+                          det2));
+        auto const center_y = _mm256_add_ps(
+            y,
+            _mm256_div_ps(_mm256_sub_ps(_mm256_mul_ps(abx, ac_sq),
+                                        _mm256_mul_ps(acx, ab_sq)),
+                          det2));
+        auto const rx = _mm256_sub_ps(center_x, x);
+        auto const ry = _mm256_sub_ps(center_y, y);
+        auto const r = _mm256_sqrt_ps(
+            _mm256_add_ps(_mm256_mul_ps(rx, rx), _mm256_mul_ps(ry, ry)));
+
+        auto const dot = _mm256_add_ps(_mm256_mul_ps(abx, acx),
+                                       _mm256_mul_ps(aby, acy));
+        auto const signed_r = _mm256_or_ps(_mm256_andnot_ps(sign, r),
+                                           _mm256_and_ps(sign, dot));
+
+        return _mm256_blendv_ps(
+            signed_r, _mm256_set1_ps(infinity), degenerate);
+    }
+
+    PA093_TARGET_AVX512 auto operator()(__m512 const x,
+                                        __m512 const y) const noexcept
+        -> __m512
+    {
+        auto const sign = _mm512_castps_si512(_mm512_set1_ps(-0.0f));
+
+        auto const abx = _mm512_sub_ps(_mm512_set1_ps(p1.x), x);
+        auto const aby = _mm512_sub_ps(_mm512_set1_ps(p1.y), y);
+        auto const acx = _mm512_sub_ps(_mm512_set1_ps(p2.x), x);
+        auto const acy = _mm512_sub_ps(_mm512_set1_ps(p2.y), y);
+
+        auto const det = _mm512_sub_ps(_mm512_mul_ps(abx, acy),
+                                       _mm512_mul_ps(acx, aby));
+        auto const degenerate =
+            _mm512_cmp_ps_mask(_mm512_abs_ps(det),
+                               _mm512_set1_ps(constants::epsilon_determinant),
+                               _CMP_LT_OQ);
+
+        auto const ab_sq = _mm512_add_ps(_mm512_mul_ps(abx, abx),
+                                         _mm512_mul_ps(aby, aby));
+        auto const ac_sq = _mm512_add_ps(_mm512_mul_ps(acx, acx),
+                                         _mm512_mul_ps(acy, acy));
+        auto const det2 = _mm512_mul_ps(_mm512_set1_ps(2.0f), det);
+        auto const center_x = _mm512_add_ps(
+            x,
+            _mm512_div_ps(_mm512_sub_ps(_mm512_mul_ps(acy, ab_sq),
+                                        _mm512_mul_ps(aby, ac_sq)),
+                          det2));
+        auto const center_y = _mm512_add_ps(
+            y,
+            _mm512_div_ps(_mm512_sub_ps(_mm512_mul_ps(abx, ac_sq),
+                                        _mm512_mul_ps(acx, ab_sq)),
+                          det2));
+        auto const rx = _mm512_sub_ps(center_x, x);
+        auto const ry = _mm512_sub_ps(center_y, y);
+        auto const r = _mm512_sqrt_ps(
+            _mm512_add_ps(_mm512_mul_ps(rx, rx), _mm512_mul_ps(ry, ry)));
+
+        auto const dot = _mm512_add_ps(_mm512_mul_ps(abx, acx),
+                                       _mm512_mul_ps(aby, acy));
+        auto const signed_r = _mm512_castsi512_ps(_mm512_or_si512(
+            _mm512_andnot_si512(sign, _mm512_castps_si512(r)),
+            _mm512_and_si512(sign, _mm512_castps_si512(dot))));
+
+        return _mm512_mask_blend_ps(
+            degenerate, signed_r, _mm512_set1_ps(infinity));
+    }
+#endif
+};
+
+/**
+ * Negated cosine of the angle between the unit direction and the direction
+ * to p; infinity if p is coincident with the origin. Follows glm::angle()
+ * without the monotonic arc cosine, so that the minimum is at the smallest
+ * angle.
+ */
+struct Misalignment
+{
+    glm::vec2 origin;
+    glm::vec2 direction;
+
+    [[nodiscard]] auto operator()(glm::vec2 const p) const noexcept -> float
+    {
+        auto const d = p - origin;
+        if (std::abs(d.x) < constants::epsilon_distance and
+            std::abs(d.y) < constants::epsilon_distance)
+        {
+            return infinity;
+        }
+
+        auto const inverse_length = 1.0f / std::sqrt(d.x * d.x + d.y * d.y);
+        auto const cosine = direction.x * (d.x * inverse_length) +
+                            direction.y * (d.y * inverse_length);
+
+        return -std::clamp(cosine, -1.0f, 1.0f);
+    }
+
+#if PA093_BATCH_X86
+    PA093_TARGET_AVX2 auto operator()(__m256 const x,
+                                      __m256 const y) const noexcept -> __m256
+    {
+        auto const sign = _mm256_set1_ps(-0.0f);
+        auto const epsilon = _mm256_set1_ps(constants::epsilon_distance);
+
+        auto const dx = _mm256_sub_ps(x, _mm256_set1_ps(origin.x));
+        auto const dy = _mm256_sub_ps(y, _mm256_set1_ps(origin.y));
+        auto const coincident = _mm256_and_ps(
+            _mm256_cmp_ps(_mm256_andnot_ps(sign, dx), epsilon, _CMP_LT_OQ),
+            _mm256_cmp_ps(_mm256_andnot_ps(sign, dy), epsilon, _CMP_LT_OQ));
+
+        auto const inverse_length = _mm256_div_ps(
+            _mm256_set1_ps(1.0f),
+            _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx),
+                                         _mm256_mul_ps(dy, dy))));
+        auto const cosine = _mm256_add_ps(
+            _mm256_mul_ps(_mm256_set1_ps(direction.x),
+                          _mm256_mul_ps(dx, inverse_length)),
+            _mm256_mul_ps(_mm256_set1_ps(direction.y),
+                          _mm256_mul_ps(dy, inverse_length)));
+        auto const clamped =
+            _mm256_min_ps(_mm256_max_ps(cosine, _mm256_set1_ps(-1.0f)),
+                          _mm256_set1_ps(1.0f));
+
+        return _mm256_blendv_ps(_mm256_xor_ps(clamped, sign),
+                                _mm256_set1_ps(infinity),
+                                coincident);
+    }
+
+    PA093_TARGET_AVX512 auto operator()(__m512 const x,
+                                        __m512 const y) const noexcept
+        -> __m512
+    {
+        auto const epsilon = _mm512_set1_ps(constants::epsilon_distance);
+
+        auto const dx = _mm512_sub_ps(x, _mm512_set1_ps(origin.x));
+        auto const dy = _mm512_sub_ps(y, _mm512_set1_ps(origin.y));
+        auto const coincident =
+            _mm512_cmp_ps_mask(_mm512_abs_ps(dx), epsilon, _CMP_LT_OQ) &
+            _mm512_cmp_ps_mask(_mm512_abs_ps(dy), epsilon, _CMP_LT_OQ);
+
+        auto const inverse_length = _mm512_div_ps(
+            _mm512_set1_ps(1.0f),
+            _mm512_sqrt_ps(_mm512_add_ps(_mm512_mul_ps(dx, dx),
+                                         _mm512_mul_ps(dy, dy))));
+        auto const cosine = _mm512_add_ps(
+            _mm512_mul_ps(_mm512_set1_ps(direction.x),
+                          _mm512_mul_ps(dx, inverse_length)),
+            _mm512_mul_ps(_mm512_set1_ps(direction.y),
+                          _mm512_mul_ps(dy, inverse_length)));
+        auto const clamped =
+            _mm512_min_ps(_mm512_max_ps(cosine, _mm512_set1_ps(-1.0f)),
+                          _mm512_set1_ps(1.0f));
+        auto const negated = _mm512_castsi512_ps(
+            _mm512_xor_si512(_mm512_castps_si512(clamped),
+                             _mm512_castps_si512(_mm512_set1_ps(-0.0f))));
+
+        return _mm512_mask_blend_ps(
+            coincident, negated, _mm512_set1_ps(infinity));
+    }
+#endif
+};
+
+/**
+ * Smallest value found so far and the index of its first occurrence
+ */
+struct Minimum
+{
+    float value = infinity;
+    std::size_t index = std::numeric_limits<std::size_t>::max();
+
+    void add(float const candidate, std::size_t const candidate_index)
+    {
+        if (candidate < value or
+            (candidate == value and candidate_index < index))
+        {
+            value = candidate;
+            index = candidate_index;
+        }
+    }
+
+    /**
+     * Like std::ranges::min_element, the first point if no value is smaller
+     * than infinity
+     */
+    [[nodiscard]] auto result() const noexcept -> std::size_t
+    {
+        return index != std::numeric_limits<std::size_t>::max() ? index : 0u;
+    }
+};
+
+template<typename F>
+void
+map_scalar(std::span<glm::vec2 const> const points,
+           F const& f,
+           std::span<float> const result,
+           std::size_t const first = 0u)
+{
+    for (auto i = first; i < points.size(); ++i)
+    {
+        result[i] = f(points[i]);
+    }
+}
+
+template<typename F>
+void
+min_scalar(std::span<glm::vec2 const> const points,
+           F const& f,
+           Minimum& minimum,
+           std::size_t const first = 0u)
+{
+    for (auto i = first; i < points.size(); ++i)
+    {
+        if (auto const value = f(points[i]); value < minimum.value)
+        {
+            minimum = { value, i };
+        }
+    }
+}
+
+template<std::size_t lanes>
+[[nodiscard]] auto
+lane_minimum(std::array<float, lanes> const& values,
+             std::array<std::int32_t, lanes> const& indices) -> Minimum
+{
+    auto minimum = Minimum{};
+    for (auto lane = std::size_t{ 0 }; lane < lanes; ++lane)
+    {
+        // Negative indices mark lanes without any value below infinity
+        if (indices[lane] >= 0)
+        {
+            minimum.add(values[lane], static_cast<std::size_t>(indices[lane]));
+        }
+    }
+
+    return minimum;
+}
+
+#if PA093_BATCH_X86
+
+struct Coordinates256
+{
+    __m256 x;
+    __m256 y;
+};
+
+struct Coordinates512
+{
+    __m512 x;
+    __m512 y;
+};
+
+/**
+ * Swaps the middle 64-bit pairs
+ */
+PA093_TARGET_AVX2 auto
+swap_middle(__m256 const v) noexcept -> __m256
+{
+    return _mm256_castpd_ps(
+        _mm256_permute4x64_pd(_mm256_castps_pd(v), _MM_SHUFFLE(3, 1, 2, 0)));
+}
+
+/**
+ * Loads eight points, deinterleaved
+ */
+PA093_TARGET_AVX2 auto
+load_avx2(glm::vec2 const* const points) noexcept -> Coordinates256
+{
+    auto const data = reinterpret_cast<float const*>(points);
+    auto const low = _mm256_loadu_ps(data);
+    auto const high = _mm256_loadu_ps(data + 8);
+
+    // Shuffling works within 128-bit halves, which leaves the points in the
+    // order 0, 1, 4, 5, 2, 3, 6, 7
+    return {
+        swap_middle(_mm256_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0))),
+        swap_middle(_mm256_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1))),
+    };
+}
+
+/**
+ * Loads sixteen points, deinterleaved
+ */
+PA093_TARGET_AVX512 auto
+load_avx512(glm::vec2 const* const points) noexcept -> Coordinates512
+{
+    auto const data = reinterpret_cast<float const*>(points);
+    auto const low = _mm512_loadu_ps(data);
+    auto const high = _mm512_loadu_ps(data + 16);
+
+    auto const even = _mm512_setr_epi32(
+        0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+    auto const odd = _mm512_add_epi32(even, _mm512_set1_epi32(1));
+
+    return {
+        _mm512_permutex2var_ps(low, even, high),
+        _mm512_permutex2var_ps(low, odd, high),
+    };
+}
+
+template<typename F>
+PA093_TARGET_AVX2 void
+map_avx2(std::span<glm::vec2 const> const points,
+         F const& f,
+         std::span<float> const result)
+{
+    auto i = std::size_t{ 0 };
+    for (; i + 8u <= points.size(); i += 8u)
+    {
+        auto const [x, y] = load_avx2(points.data() + i);
+        _mm256_storeu_ps(result.data() + i, f(x, y));
+    }
+
+    map_scalar(points, f, result, i);
+}
+
+template<typename F>
+PA093_TARGET_AVX512 void
+map_avx512(std::span<glm::vec2 const> const points,
+           F const& f,
+           std::span<float> const result)
+{
+    auto i = std::size_t{ 0 };
+    for (; i + 16u <= points.size(); i += 16u)
+    {
+        auto const [x, y] = load_avx512(points.data() + i);
+        _mm512_storeu_ps(result.data() + i, f(x, y));
+    }
+
+    map_scalar(points, f, result, i);
+}
+
+template<typename F>
+PA093_TARGET_AVX2 auto
+min_avx2(std::span<glm::vec2 const> const points, F const& f) -> std::size_t
+{
+    // Every lane keeps the first minimum of its points
+    auto best = _mm256_set1_ps(infinity);
+    auto best_index = _mm256_set1_epi32(-1);
+    auto index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+    auto i = std::size_t{ 0 };
+    for (; i + 8u <= points.size(); i += 8u)
+    {
+        auto const [x, y] = load_avx2(points.data() + i);
+        auto const value = f(x, y);
+        auto const less = _mm256_cmp_ps(value, best, _CMP_LT_OQ);
+
+        best = _mm256_blendv_ps(best, value, less);
+        best_index = _mm256_blendv_epi8(
+            best_index, index, _mm256_castps_si256(less));
+        index = _mm256_add_epi32(index, _mm256_set1_epi32(8));
+    }
+
+    auto values = std::array<float, 8u>{};
+    auto indices = std::array<std::int32_t, 8u>{};
+    _mm256_storeu_ps(values.data(), best);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(indices.data()),
+                        best_index);
+
+    auto minimum = lane_minimum(values, indices);
+    min_scalar(points, f, minimum, i);
+    return minimum.result();
+}
+
+template<typename F>
+PA093_TARGET_AVX512 auto
+min_avx512(std::span<glm::vec2 const> const points, F const& f)
+    -> std::size_t
+{
+    // Every lane keeps the first minimum of its points
+    auto best = _mm512_set1_ps(infinity);
+    auto best_index = _mm512_set1_epi32(-1);
+    auto index = _mm512_setr_epi32(
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+    auto i = std::size_t{ 0 };
+    for (; i + 16u <= points.size(); i += 16u)
+    {
+        auto const [x, y] = load_avx512(points.data() + i);
+        auto const value = f(x, y);
+        auto const less = _mm512_cmp_ps_mask(value, best, _CMP_LT_OQ);
+
+        best = _mm512_mask_blend_ps(less, best, value);
+        best_index = _mm512_mask_blend_epi32(less, best_index, index);
+        index = _mm512_add_epi32(index, _mm512_set1_epi32(16));
+    }
+
+    auto values = std::array<float, 16u>{};
+    auto indices = std::array<std::int32_t, 16u>{};
+    _mm512_storeu_ps(values.data(), best);
+    _mm512_storeu_si512(indices.data(), best_index);
+
+    auto minimum = lane_minimum(values, indices);
+    min_scalar(points, f, minimum, i);
+    return minimum.result();
+}
+
+#endif
+
+template<InstructionSet set, typename F>
+void
+map(std::span<glm::vec2 const> const points,
+    F const& f,
+    std::span<float> const result)
+{
+    Expects(result.size() == points.size());
+
+#if PA093_BATCH_X86
+    if constexpr (set == InstructionSet::avx512)
+    {
+        return map_avx512(points, f, result);
+    }
+    else if constexpr (set == InstructionSet::avx2)
+    {
+        return map_avx2(points, f, result);
+    }
+#endif
+
+    map_scalar(points, f, result);
+}
+
+template<InstructionSet set, typename F>
+[[nodiscard]] auto
+min(std::span<glm::vec2 const> const points, F const& f) -> std::size_t
+{
+    Expects(points.size() <= max_points);
+
+#if PA093_BATCH_X86
+    if constexpr (set == InstructionSet::avx512)
+    {
+        return min_avx512(points, f);
+    }
+    else if constexpr (set == InstructionSet::avx2)
+    {
+        return min_avx2(points, f);
+    }
+#endif
+
+    auto minimum = Minimum{};
+    min_scalar(points, f, minimum);
+    return minimum.result();
+}
+
+template<InstructionSet set>
+constexpr auto make_kernels = Kernels{
+    .orientations =
+        [](std::span<glm::vec2 const> const points,
+           glm::vec2 const a,
+           glm::vec2 const b,
+           std::span<float> const result)
+    { map<set>(points, Orientation{ a, b - a }, result); },
+    .closest_point = [](std::span<glm::vec2 const> const points,
+                        glm::vec2 const p)
+    { return min<set>(points, Distance2{ p }); },
+    .min_delaunay_distance =
+        [](std::span<glm::vec2 const> const points,
+           glm::vec2 const p1,
+           glm::vec2 const p2)
+    { return min<set>(points, DelaunayDistance{ p1, p2 }); },
+    .most_aligned =
+        [](std::span<glm::vec2 const> const points,
+           glm::vec2 const origin,
+           glm::vec2 const direction)
+    { return min<set>(points, Misalignment{ origin, direction }); },
+};
+
+} // namespace
+
+auto
+instruction_set_name(InstructionSet const set) noexcept -> std::string_view
+{
+    switch (set)
+    {
+        case InstructionSet::scalar:
+            return "scalar";
+        case InstructionSet::avx2:
+            return "AVX2";
+        case InstructionSet::avx512:
+            return "AVX-512";
+    }
+
+    return {};
+}
+
+auto
+supported_instruction_set() noexcept -> InstructionSet
+{
+#if PA093_BATCH_X86
+    static auto const set = []
+    {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f"))
+        {
+            return InstructionSet::avx512;
+        }
+        if (__builtin_cpu_supports("avx2"))
+        {
+            return InstructionSet::avx2;
+        }
+        return InstructionSet::scalar;
+    }();
+
+    return set;
+#else
+    return InstructionSet::scalar;
+#endif
+}
+
+auto
+kernels(InstructionSet const set) noexcept -> Kernels const&
+{
+    static constexpr auto all_kernels = std::array{
+        make_kernels<InstructionSet::scalar>,
+        make_kernels<InstructionSet::avx2>,
+        make_kernels<InstructionSet::avx512>,
+    };
+
+    Expects(set <= supported_instruction_set());
+    return all_kernels[static_cast<std::size_t>(set)];
+}
+
+} // namespace pa093::algorithm::batch
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+#include <glm/glm.hpp>
+
+namespace pa093::algorithm::batch
+{
+
+/**
+ * Vectorized kernels evaluating one small geometric function over many
+ * points.
+ *
+ * Every kernel has a scalar, an AVX2 and an AVX-512 implementation; the
+ * widest one the CPU supports is picked at run time. All implementations
+ * perform the same single precision operations in the same order as the
+ * scalar functions they replace, so they return identical results.
+ */
+enum class InstructionSet
+{
+    scalar,
+    avx2,
+    avx512,
+};
+
+[[nodiscard]] auto
+instruction_set_name(InstructionSet set) noexcept -> std::string_view;
+
+/**
+ * The widest instruction set supported by the CPU
+ */
+[[nodiscard]] auto
+supported_instruction_set() noexcept -> InstructionSet;
+
+struct Kernels
+{
+    /**
+     * Writes the determinant of (b - a, p - a) for every point p, i.e.
+     * twice the signed area of (a, b, p)
+     */
+    void (*orientations)(std::span<glm::vec2 const> points,
+                         glm::vec2 a,
+                         glm::vec2 b,
+                         std::span<float> result);
+
+    /**
+     * Index of the first point closest to p; points.size() if there are no
+     * points
+     */
+    auto (*closest_point)(std::span<glm::vec2 const> points, glm::vec2 p)
+        -> std::size_t;
+
+    /**
+     * Index of the first point p minimizing the Delaunay distance to the
+     * edge (p1, p2), see triangulation::delaunay_distance()
+     */
+    auto (*min_delaunay_distance)(std::span<glm::vec2 const> points,
+                                  glm::vec2 p1,
+                                  glm::vec2 p2) -> std::size_t;
+
+    /**
+     * Index of the first point p whose direction from origin is closest to
+     * the unit direction, ignoring points coincident with origin; 0 if all
+     * points are
+     */
+    auto (*most_aligned)(std::span<glm::vec2 const> points,
+                         glm::vec2 origin,
+                         glm::vec2 direction) -> std::size_t;
+};
+
+/**
+ * Kernels of the given instruction set, which must be supported
+ */
+[[nodiscard]] auto
+kernels(InstructionSet set = supported_instruction_set()) noexcept
+    -> Kernels const&;
+
+inline void
+orientations(std::span<glm::vec2 const> const points,
+             glm::vec2 const a,
+             glm::vec2 const b,
+             std::span<float> const result)
+{
+    kernels().orientations(points, a, b, result);
+}
+
+[[nodiscard]] inline auto
+closest_point(std::span<glm::vec2 const> const points, glm::vec2 const p)
+    -> std::size_t
+{
+    return kernels().closest_point(points, p);
+}
+
+[[nodiscard]] inline auto
+min_delaunay_distance(std::span<glm::vec2 const> const points,
+                      glm::vec2 const p1,
+                      glm::vec2 const p2) -> std::size_t
+{
+    return kernels().min_delaunay_distance(points, p1, p2);
+}
+
+[[nodiscard]] inline auto
+most_aligned(std::span<glm::vec2 const> const points,
+             glm::vec2 const origin,
+             glm::vec2 const direction) -> std::size_t
+{
+    return kernels().most_aligned(points, origin, direction);
+}
+
+} // namespace pa093::algorithm::batch
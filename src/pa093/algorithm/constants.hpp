@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 namespace pa093::algorithm::constants
 {
 
@@ -11,5 +13,10 @@ inline constexpr auto epsilon_distance = 1e-8f;
  * Matrices with absolute determinant smaller than this are considered singular
  */
 inline constexpr auto epsilon_determinant = 1e-8f;
+/**
+ * Largest absolute integer grid coordinate for which the exact predicates on
+ * grid points cannot overflow
+ */
+inline constexpr auto max_grid_coordinate = std::int32_t{ 1 } << 29;
 
 } // namespace pa093::algorithm::constants
@@ -3,12 +3,15 @@
 #include <algorithm>
 #include <iterator>
 #include <limits>
+#include <memory>
 #include <ranges>
+#include <span>
 
 #include <glm/glm.hpp>
 #include <glm/gtx/norm.hpp>
 #include <glm/gtx/vector_angle.hpp>
 
+#include "pa093/algorithm/batch.hpp"
 #include "pa093/algorithm/constants.hpp"
 
 namespace pa093::algorithm::convex_hull
@@ -56,20 +59,36 @@ public:
             auto const last_dir = glm::normalize(*curr - prev_point);
             prev_point = *curr;
 
-            curr = std::ranges::min_element(
-                first,
-                last,
-                std::less{},
-                [&](glm::vec2 const point)
-                {
-                    if (glm::all(glm::epsilonEqual(
-                            point, *curr, constants::epsilon_distance)))
+            if constexpr (std::contiguous_iterator<I> and
+                          std::sized_sentinel_for<S, I>)
+            {
+                // The smallest angle is the largest cosine, which vectorizes
+                auto const points = std::span{
+                    std::to_address(first),
+                    static_cast<std::size_t>(last - first),
+                };
+                curr = first + static_cast<std::iter_difference_t<I>>(
+                                   batch::most_aligned(
+                                       points, prev_point, last_dir));
+            }
+            else
+            {
+                curr = std::ranges::min_element(
+                    first,
+                    last,
+                    std::less{},
+                    [&](glm::vec2 const point)
                     {
-                        return std::numeric_limits<float>::infinity();
-                    }
+                        if (glm::all(glm::epsilonEqual(
+                                point, *curr, constants::epsilon_distance)))
+                        {
+                            return std::numeric_limits<float>::infinity();
+                        }
 
-                    return glm::angle(last_dir, glm::normalize(point - *curr));
-                });
+                        return glm::angle(last_dir,
+                                          glm::normalize(point - *curr));
+                    });
+            }
         } while (curr != start);
 
         return result;
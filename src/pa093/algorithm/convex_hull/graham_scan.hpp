@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <iterator>
 #include <limits>
+#include <memory_resource>
 #include <ranges>
 #include <vector>
 
@@ -18,6 +19,13 @@ namespace pa093::algorithm::convex_hull
 class GrahamScan
 {
 public:
+    [[nodiscard]] explicit GrahamScan(
+        std::pmr::memory_resource* const resource =
+            std::pmr::get_default_resource()) noexcept
+        : points_{ resource }
+    {
+    }
+
     template<std::ranges::input_range R, std::output_iterator<glm::vec2> O>
     requires std::same_as<std::ranges::range_value_t<R>, glm::vec2>
     auto operator()(R&& range, O const result) -> O
@@ -119,7 +127,7 @@ public:
     void reset() { points_.clear(); }
 
 private:
-    std::vector<glm::vec2> points_;
+    std::pmr::vector<glm::vec2> points_;
 };
 
 } // namespace pa093::algorithm::convex_hull
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <cmath>
+#include <cstdint>
 #include <optional>
+#include <span>
 
 #include <glm/glm.hpp>
 #include <glm/gtx/norm.hpp>
@@ -16,15 +18,16 @@ circumcircle_center(glm::vec2 const a,
                     glm::vec2 const b,
                     glm::vec2 const c) noexcept -> std::optional<glm::vec2>
 {
-    auto const a_sq = glm::length2(a);
-    auto const b_sq = glm::length2(b);
-    auto const c_sq = glm::length2(c);
+    // Work relative to a, so that precision does not depend on the distance
+    // of the triangle from the origin
+    auto const ab = b - a;
+    auto const ac = c - a;
 
     auto const det = [&]
     {
         auto m = glm::mat2{};
-        m[0] = b - a;
-        m[1] = c - a;
+        m[0] = ab;
+        m[1] = ac;
         return glm::determinant(m);
     }();
 
@@ -34,10 +37,263 @@ circumcircle_center(glm::vec2 const a,
         return std::nullopt;
     }
 
-    return glm::vec2{
-        a_sq * (b.y - c.y) + b_sq * (c.y - a.y) + c_sq * (a.y - b.y),
-        a_sq * (c.x - b.x) + b_sq * (a.x - c.x) + c_sq * (b.x - a.x),
+    auto const ab_sq = glm::length2(ab);
+    auto const ac_sq = glm::length2(ac);
+
+    return a + glm::vec2{
+        ac.y * ab_sq - ab.y * ac_sq,
+        ab.x * ac_sq - ac.x * ab_sq,
     } / (2.0f * det);
 }
 
+/**
+ * Twice the signed area of the triangle (a, b, c), evaluated in double
+ * precision; positive if the points are in counter-clockwise order
+ */
+[[nodiscard]] inline auto
+orientation(glm::vec2 const a, glm::vec2 const b, glm::vec2 const c) noexcept
+    -> double
+{
+    return (static_cast<double>(b.x) - a.x) * (static_cast<double>(c.y) - a.y) -
+           (static_cast<double>(b.y) - a.y) * (static_cast<double>(c.x) - a.x);
+}
+
+/**
+ * Positive if p lies inside the circumcircle of the counter-clockwise
+ * triangle (a, b, c), negative if outside, evaluated in double precision
+ */
+[[nodiscard]] inline auto
+in_circle(glm::vec2 const a,
+          glm::vec2 const b,
+          glm::vec2 const c,
+          glm::vec2 const p) noexcept -> double
+{
+    auto const dx = static_cast<double>(a.x) - p.x;
+    auto const dy = static_cast<double>(a.y) - p.y;
+    auto const ex = static_cast<double>(b.x) - p.x;
+    auto const ey = static_cast<double>(b.y) - p.y;
+    auto const fx = static_cast<double>(c.x) - p.x;
+    auto const fy = static_cast<double>(c.y) - p.y;
+
+    auto const ap = dx * dx + dy * dy;
+    auto const bp = ex * ex + ey * ey;
+    auto const cp = fx * fx + fy * fy;
+
+    return dx * (ey * cp - bp * fy) - dy * (ex * cp - bp * fx) +
+           ap * (ex * fy - ey * fx);
+}
+
+/**
+ * Twice the signed area of the triangle (a, b, c) of grid points; exact for
+ * coordinates within constants::max_grid_coordinate
+ */
+[[nodiscard]] inline auto
+orientation(glm::ivec2 const a, glm::ivec2 const b, glm::ivec2 const c) noexcept
+    -> std::int64_t
+{
+    return (std::int64_t{ b.x } - a.x) * (std::int64_t{ c.y } - a.y) -
+           (std::int64_t{ b.y } - a.y) * (std::int64_t{ c.x } - a.x);
+}
+
+namespace detail
+{
+
+#if defined(__SIZEOF_INT128__)
+
+__extension__ typedef __int128 Int128;
+
+#else
+
+/**
+ * Signed 128-bit integer for compilers without a native one, in two's
+ * complement; results are exact as long as they fit in 128 bits
+ */
+class Int128
+{
+public:
+    constexpr Int128(std::int64_t const value) noexcept
+        : low_{ static_cast<std::uint64_t>(value) }
+        , high_{ value < 0 ? ~std::uint64_t{ 0 } : std::uint64_t{ 0 } }
+    {
+    }
+
+    [[nodiscard]] friend constexpr auto operator+(Int128 const x,
+                                                  Int128 const y) noexcept
+        -> Int128
+    {
+        auto const low = x.low_ + y.low_;
+        return { low, x.high_ + y.high_ + (low < x.low_ ? 1u : 0u) };
+    }
+
+    [[nodiscard]] friend constexpr auto operator-(Int128 const x,
+                                                  Int128 const y) noexcept
+        -> Int128
+    {
+        return x + Int128{ ~y.low_, ~y.high_ } + Int128{ 1 };
+    }
+
+    [[nodiscard]] friend constexpr auto operator*(Int128 const x,
+                                                  Int128 const y) noexcept
+        -> Int128
+    {
+        // Products of the high words only affect bits past 128
+        auto const low = multiply(x.low_, y.low_);
+        return { low.low_, low.high_ + x.low_ * y.high_ + x.high_ * y.low_ };
+    }
+
+    [[nodiscard]] friend constexpr auto operator<(Int128 const x,
+                                                  int const y) noexcept -> bool
+    {
+        return (x - Int128{ y }).negative();
+    }
+
+    [[nodiscard]] friend constexpr auto operator>(Int128 const x,
+                                                  int const y) noexcept -> bool
+    {
+        return (Int128{ y } - x).negative();
+    }
+
+private:
+    std::uint64_t low_;
+    std::uint64_t high_;
+
+    constexpr Int128(std::uint64_t const low, std::uint64_t const high) noexcept
+        : low_{ low }
+        , high_{ high }
+    {
+    }
+
+    [[nodiscard]] constexpr auto negative() const noexcept -> bool
+    {
+        return (high_ >> 63u) != 0u;
+    }
+
+    /**
+     * Full product of unsigned 64-bit words, by 32-bit halves
+     */
+    [[nodiscard]] static constexpr auto multiply(std::uint64_t const x,
+                                                 std::uint64_t const y) noexcept
+        -> Int128
+    {
+        constexpr auto mask = std::uint64_t{ 0xFFFFFFFFu };
+
+        auto const ll = (x & mask) * (y & mask);
+        auto const lh = (x & mask) * (y >> 32u);
+        auto const hl = (x >> 32u) * (y & mask);
+        auto const hh = (x >> 32u) * (y >> 32u);
+
+        auto const middle = (ll >> 32u) + (lh & mask) + (hl & mask);
+        return { (middle << 32u) | (ll & mask),
+                 hh + (lh >> 32u) + (hl >> 32u) + (middle >> 32u) };
+    }
+};
+
+#endif
+
+} // namespace detail
+
+/**
+ * Sign of the in-circle determinant of grid points, with the same meaning as
+ * for floating point points; exact for coordinates within
+ * constants::max_grid_coordinate
+ */
+[[nodiscard]] inline auto
+in_circle(glm::ivec2 const a,
+          glm::ivec2 const b,
+          glm::ivec2 const c,
+          glm::ivec2 const p) noexcept -> int
+{
+    using wide_type = detail::Int128;
+
+    // Differences take at most 31 bits and squared lengths 62, so every term
+    // of the expansion fits in 124 bits
+    auto const dx = std::int64_t{ a.x } - p.x;
+    auto const dy = std::int64_t{ a.y } - p.y;
+    auto const ex = std::int64_t{ b.x } - p.x;
+    auto const ey = std::int64_t{ b.y } - p.y;
+    auto const fx = std::int64_t{ c.x } - p.x;
+    auto const fy = std::int64_t{ c.y } - p.y;
+
+    auto const ap = dx * dx + dy * dy;
+    auto const bp = ex * ex + ey * ey;
+    auto const cp = fx * fx + fy * fy;
+
+    auto const det =
+        dx * (wide_type{ ey } * cp - wide_type{ bp } * fy) -
+        dy * (wide_type{ ex } * cp - wide_type{ bp } * fx) +
+        ap * wide_type{ ex * fy - ey * fx };
+
+    return (det > 0) - (det < 0);
+}
+
+/**
+ * Signed area of a simple polygon; positive if counter-clockwise
+ */
+[[nodiscard]] inline auto
+polygon_area(std::span<glm::vec2 const> const polygon) noexcept -> float
+{
+    auto area = 0.0f;
+    if (polygon.empty())
+    {
+        return area;
+    }
+
+    // Shoelace formula relative to the first vertex
+    auto const origin = polygon.front();
+    for (auto i = std::size_t{ 2 }; i < polygon.size(); ++i)
+    {
+        auto m = glm::mat2{};
+        m[0] = polygon[i - 1u] - origin;
+        m[1] = polygon[i] - origin;
+        area += glm::determinant(m);
+    }
+
+    return area * 0.5f;
+}
+
+/**
+ * Centroid of the area of a simple polygon, or the mean of its vertices if
+ * the area is degenerate
+ */
+[[nodiscard]] inline auto
+polygon_centroid(std::span<glm::vec2 const> const polygon) noexcept
+    -> std::optional<glm::vec2>
+{
+    if (polygon.empty())
+    {
+        return std::nullopt;
+    }
+
+    auto const origin = polygon.front();
+    auto weighted_sum = glm::vec2{};
+    auto area = 0.0f;
+    auto mean = glm::vec2{};
+
+    for (auto i = std::size_t{ 1 }; i < polygon.size(); ++i)
+    {
+        mean += polygon[i] - origin;
+
+        if (i >= 2u)
+        {
+            auto const a = polygon[i - 1u] - origin;
+            auto const b = polygon[i] - origin;
+
+            auto m = glm::mat2{};
+            m[0] = a;
+            m[1] = b;
+            auto const det = glm::determinant(m);
+
+            area += det;
+            weighted_sum += det * (a + b);
+        }
+    }
+
+    if (std::abs(area) < constants::epsilon_determinant)
+    {
+        return origin + mean / static_cast<float>(polygon.size());
+    }
+
+    return origin + weighted_sum / (3.0f * area);
+}
+
 } // namespace pa093::algorithm
@@ -0,0 +1,86 @@
+#include <pa093/algorithm/graph/closest_pair.hpp>
+
+#include <glm/gtx/norm.hpp>
+
+#include <pa093/concurrency/parallel_for.hpp>
+
+namespace pa093::algorithm::graph
+{
+
+auto
+ClosestPair::operator()(triangulation_type const& triangulation)
+    -> std::optional<edge_type>
+{
+    reset();
+
+    auto const length2 = [&](index_type const a, index_type const b)
+    { return glm::distance2(triangulation.point(a), triangulation.point(b)); };
+
+    auto closest = std::optional<Candidate>{};
+    auto const consider = [](std::optional<Candidate>& best,
+                             Candidate const candidate)
+    {
+        if (not best or candidate.length2 < best->length2)
+        {
+            best = candidate;
+        }
+    };
+
+    // Coincident points are merged within a distance, so their pairs are
+    // candidates of their actual length
+    for (auto const [skipped, kept] : triangulation.duplicates())
+    {
+        consider(closest, { length2(skipped, kept), { skipped, kept } });
+    }
+
+    if (triangulation.num_triangles() == 0u)
+    {
+        // Collinear points; only neighbours along the line are candidates
+        auto const hull = triangulation.hull();
+        for (auto i = std::size_t{ 1 }; i < hull.size(); ++i)
+        {
+            auto const a = hull[i - 1u];
+            auto const b = hull[i];
+            consider(closest, { length2(a, b), { a, b } });
+        }
+    }
+    else
+    {
+        // Every edge has a half-edge in the scan, so no need to skip twins
+        chunk_pairs_.assign(concurrency::max_chunk_count(*jobs_), std::nullopt);
+
+        auto const num_chunks = concurrency::parallel_for_chunks(
+            *jobs_,
+            triangulation.num_halfedges(),
+            [&](std::size_t const chunk,
+                std::size_t const begin,
+                std::size_t const end)
+            {
+                for (auto e = begin; e < end; ++e)
+                {
+                    auto const a =
+                        triangulation.origin(static_cast<index_type>(e));
+                    auto const b =
+                        triangulation.target(static_cast<index_type>(e));
+                    consider(chunk_pairs_[chunk], { length2(a, b), { a, b } });
+                }
+            });
+
+        for (auto chunk = std::size_t{ 0 }; chunk < num_chunks; ++chunk)
+        {
+            if (chunk_pairs_[chunk])
+            {
+                consider(closest, *chunk_pairs_[chunk]);
+            }
+        }
+    }
+
+    if (not closest)
+    {
+        return std::nullopt;
+    }
+
+    return closest->edge;
+}
+
+} // namespace pa093::algorithm::graph
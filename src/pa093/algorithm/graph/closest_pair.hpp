@@ -0,0 +1,58 @@
+#pragma once
+
+#include <memory_resource>
+#include <optional>
+#include <vector>
+
+#include <pa093/concurrency/job_system.hpp>
+#include <pa093/datastructure/triangulation.hpp>
+
+namespace pa093::algorithm::graph
+{
+
+/**
+ * Closest pair of points, found as the shortest edge of a Delaunay
+ * triangulation (the nearest neighbour of a point is always one of its
+ * Delaunay neighbours).
+ *
+ * Points the triangulation merged with a nearby point are paired with that
+ * point only, so a pair involving them is the closest within the merge
+ * distance (constants::epsilon_distance).
+ */
+class ClosestPair
+{
+public:
+    using triangulation_type = datastructure::Triangulation;
+    using index_type = triangulation_type::index_type;
+    using edge_type = triangulation_type::edge_type;
+
+    [[nodiscard]] explicit ClosestPair(
+        std::pmr::memory_resource* const resource =
+            std::pmr::get_default_resource(),
+        concurrency::JobSystem& jobs =
+            concurrency::JobSystem::instance()) noexcept
+        : jobs_{ &jobs }
+        , chunk_pairs_{ resource }
+    {
+    }
+
+    /**
+     * The closest pair, or nullopt for less than two points
+     */
+    [[nodiscard]] auto operator()(triangulation_type const& triangulation)
+        -> std::optional<edge_type>;
+
+    void reset() { chunk_pairs_.clear(); }
+
+private:
+    struct Candidate
+    {
+        float length2;
+        edge_type edge;
+    };
+
+    concurrency::JobSystem* jobs_;
+    std::pmr::vector<std::optional<Candidate>> chunk_pairs_;
+};
+
+} // namespace pa093::algorithm::graph
@@ -0,0 +1,95 @@
+#include <pa093/algorithm/graph/euclidean_mst.hpp>
+
+#include <cmath>
+#include <ranges>
+#include <tuple>
+
+#include <glm/gtx/norm.hpp>
+
+#include <pa093/concurrency/parallel_sort.hpp>
+
+namespace pa093::algorithm::graph
+{
+
+void
+EuclideanMST::reset()
+{
+    candidates_.clear();
+    tree_edges_.clear();
+    components_.clear();
+    total_length_ = 0.0;
+}
+
+void
+EuclideanMST::build(triangulation_type const& triangulation)
+{
+    reset();
+
+    auto const num_points = triangulation.num_points();
+    if (num_points < 2u)
+    {
+        return;
+    }
+
+    auto const add_candidate = [&](index_type const a, index_type const b)
+    {
+        candidates_.push_back({
+            .length2 =
+                glm::distance2(triangulation.point(a), triangulation.point(b)),
+            .edge = { a, b },
+        });
+    };
+
+    candidates_.reserve(
+        (triangulation.num_halfedges() + triangulation.hull().size()) / 2u +
+        triangulation.duplicates().size());
+
+    triangulation.for_each_edge(
+        [&](index_type const e)
+        { add_candidate(triangulation.origin(e), triangulation.target(e)); });
+
+    if (triangulation.num_triangles() == 0u)
+    {
+        // Collinear points; only neighbours along the line are candidates
+        auto const hull = triangulation.hull();
+        for (auto i = std::size_t{ 1 }; i < hull.size(); ++i)
+        {
+            add_candidate(hull[i - 1u], hull[i]);
+        }
+    }
+
+    for (auto const [skipped, kept] : triangulation.duplicates())
+    {
+        add_candidate(skipped, kept);
+    }
+
+    // Break length ties by index, so that the tree is deterministic
+    concurrency::parallel_sort(*jobs_,
+                               candidates_,
+                               std::less{},
+                               [](CandidateEdge const& candidate)
+                               {
+                                   return std::tuple{ candidate.length2,
+                                                      candidate.edge[0],
+                                                      candidate.edge[1] };
+                               });
+
+    components_.assign(num_points);
+    tree_edges_.reserve(num_points - 1u);
+
+    for (auto const& [length2, edge] : candidates_)
+    {
+        if (components_.unite(edge[0], edge[1]))
+        {
+            tree_edges_.push_back(edge);
+            total_length_ += std::sqrt(static_cast<double>(length2));
+
+            if (components_.num_sets() == 1u)
+            {
+                break;
+            }
+        }
+    }
+}
+
+} // namespace pa093::algorithm::graph
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <memory_resource>
+#include <vector>
+
+#include <pa093/concurrency/job_system.hpp>
+#include <pa093/datastructure/disjoint_sets.hpp>
+#include <pa093/datastructure/triangulation.hpp>
+
+namespace pa093::algorithm::graph
+{
+
+/**
+ * Euclidean minimum spanning tree, built by Kruskal's algorithm over the
+ * edges of a Delaunay triangulation (which always contain the EMST).
+ *
+ * Coincident points skipped by the triangulation are joined to their kept
+ * counterpart by edges of their actual length, as the triangulation merges
+ * points within a distance (constants::epsilon_distance). The tree is then
+ * minimal up to that distance per skipped point.
+ */
+class EuclideanMST
+{
+public:
+    using triangulation_type = datastructure::Triangulation;
+    using index_type = triangulation_type::index_type;
+    using edge_type = triangulation_type::edge_type;
+
+    [[nodiscard]] explicit EuclideanMST(
+        std::pmr::memory_resource* const resource =
+            std::pmr::get_default_resource(),
+        concurrency::JobSystem& jobs =
+            concurrency::JobSystem::instance()) noexcept
+        : jobs_{ &jobs }
+        , candidates_{ resource }
+        , tree_edges_{ resource }
+        , components_{ resource }
+    {
+    }
+
+    template<std::output_iterator<edge_type> O>
+    auto operator()(triangulation_type const& triangulation, O const result)
+        -> O
+    {
+        build(triangulation);
+        return std::ranges::copy(tree_edges_, result).out;
+    }
+
+    /**
+     * Sum of edge lengths of the last built tree
+     */
+    [[nodiscard]] auto total_length() const noexcept -> double
+    {
+        return total_length_;
+    }
+
+    void reset();
+
+private:
+    struct CandidateEdge
+    {
+        float length2;
+        edge_type edge;
+    };
+
+    concurrency::JobSystem* jobs_;
+    std::pmr::vector<CandidateEdge> candidates_;
+    std::pmr::vector<edge_type> tree_edges_;
+    datastructure::DisjointSets components_;
+    double total_length_ = 0.0;
+
+    void build(triangulation_type const& triangulation);
+};
+
+} // namespace pa093::algorithm::graph
@@ -4,6 +4,7 @@
 #include <concepts>
 #include <functional>
 #include <iterator>
+#include <memory_resource>
 #include <ranges>
 #include <vector>
 
@@ -21,6 +22,13 @@ public:
     using node_type = typename tree_type::node_type;
     using point_type = typename tree_type::point_type;
 
+    [[nodiscard]] explicit BuildKDTree(
+        std::pmr::memory_resource* const resource =
+            std::pmr::get_default_resource()) noexcept
+        : points_{ resource }
+    {
+    }
+
     template<std::ranges::input_range R>
     requires std::same_as<std::ranges::range_value_t<R>, point_type>
     void operator()(R&& range, tree_type& tree)
@@ -44,7 +52,7 @@ public:
     void reset() { points_.clear(); }
 
 private:
-    std::vector<point_type> points_;
+    std::pmr::vector<point_type> points_;
 
     template<std::forward_iterator I, std::sentinel_for<I> S>
     requires std::same_as<std::iter_value_t<I>, point_type>
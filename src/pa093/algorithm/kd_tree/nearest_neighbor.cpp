@@ -0,0 +1 @@
+#include <pa093/algorithm/kd_tree/nearest_neighbor.hpp>
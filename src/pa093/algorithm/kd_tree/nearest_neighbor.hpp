@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+#include <glm/gtx/norm.hpp>
+
+#include <pa093/datastructure/kd_tree.hpp>
+
+namespace pa093::algorithm::kd_tree
+{
+
+template<typename T, std::size_t dim>
+class NearestNeighbor
+{
+public:
+    using tree_type = datastructure::KDTree<T, dim>;
+    using node_id_type = typename tree_type::node_id_type;
+    using node_type = typename tree_type::node_type;
+    using point_type = typename tree_type::point_type;
+    using scalar_type = typename tree_type::scalar_type;
+
+    /**
+     * The leaf nearest to the query point, or node_type::null for an empty
+     * tree
+     */
+    [[nodiscard]] auto operator()(tree_type const& tree,
+                                  point_type const query) const -> node_id_type
+    {
+        auto best = node_type::null;
+        auto best_distance2 = std::numeric_limits<scalar_type>::infinity();
+
+        visit_subtree(tree, tree.root(), 0u, query, best, best_distance2);
+
+        return best;
+    }
+
+private:
+    static void visit_subtree(tree_type const& tree,
+                              node_id_type const node_id,
+                              std::size_t const depth,
+                              point_type const query,
+                              node_id_type& best,
+                              scalar_type& best_distance2)
+    {
+        if (not node_id)
+        {
+            return;
+        }
+
+        if (tree.is_leaf(node_id))
+        {
+            if (auto const distance2 =
+                    glm::distance2(tree.leaf(node_id), query);
+                distance2 < best_distance2)
+            {
+                best = node_id;
+                best_distance2 = distance2;
+            }
+            return;
+        }
+
+        auto const& node = tree.node(node_id);
+        auto const current_dim = static_cast<int>(depth % dim);
+        auto const offset = query[current_dim] - node.pivot;
+
+        // Descend to the query's side first; the other side can only hold
+        // a closer point if the splitting plane is closer than the best
+        auto const [near, far] = offset < scalar_type{ 0 }
+                                     ? std::pair{ node.left, node.right }
+                                     : std::pair{ node.right, node.left };
+
+        visit_subtree(tree, near, depth + 1u, query, best, best_distance2);
+        if (offset * offset < best_distance2)
+        {
+            visit_subtree(tree, far, depth + 1u, query, best, best_distance2);
+        }
+    }
+};
+
+using NearestNeighbor2f = NearestNeighbor<float, 2u>;
+
+} // namespace pa093::algorithm::kd_tree
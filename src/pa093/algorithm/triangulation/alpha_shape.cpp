@@ -0,0 +1,163 @@
+#include <pa093/algorithm/triangulation/alpha_shape.hpp>
+
+#include <cmath>
+#include <limits>
+#include <tuple>
+
+#include <pa093/algorithm/geometric_functions.hpp>
+#include <pa093/concurrency/parallel_for.hpp>
+#include <pa093/concurrency/parallel_sort.hpp>
+
+namespace pa093::algorithm::triangulation
+{
+
+void
+AlphaShape::operator()(triangulation_type const& triangulation)
+{
+    reset();
+
+    constexpr auto infinity = std::numeric_limits<float>::infinity();
+
+    // Triangles enter the shape once alpha reaches their circumradius
+    radii_.resize(triangulation.num_triangles());
+    concurrency::parallel_for(
+        *jobs_,
+        radii_.size(),
+        [&](std::size_t const t)
+        {
+            auto const [i1, i2, i3] =
+                triangulation.triangle(static_cast<index_type>(t));
+            auto const p1 = triangulation.point(i1);
+            auto const center = circumcircle_center(
+                p1, triangulation.point(i2), triangulation.point(i3));
+
+            radii_[t] = center ? glm::distance(*center, p1) : infinity;
+        });
+
+    triangles_.reserve(radii_.size());
+    for (auto t = index_type{ 0 }; t < radii_.size(); ++t)
+    {
+        triangles_.push_back({ .radius = radii_[t], .index = t });
+    }
+    concurrency::parallel_sort(
+        *jobs_,
+        triangles_,
+        std::less{},
+        [](Triangle const& triangle)
+        { return std::tuple{ triangle.radius, triangle.index }; });
+
+    auto const finite_end = std::ranges::partition_point(
+        triangles_,
+        [](float const radius) { return std::isfinite(radius); },
+        &Triangle::radius);
+    if (finite_end != triangles_.begin())
+    {
+        min_alpha_ = triangles_.front().radius;
+        max_alpha_ = std::prev(finite_end)->radius;
+    }
+
+    // Edges are on the boundary while exactly one of their triangles is in
+    triangulation.for_each_edge(
+        [&](index_type const e)
+        {
+            auto const twin = triangulation.twin(e);
+            auto const r1 = radii_[triangulation_type::triangle_of(e)];
+            auto const r2 = twin == triangulation_type::invalid_index
+                                ? infinity
+                                : radii_[triangulation_type::triangle_of(twin)];
+
+            if (r1 == r2)
+            {
+                return;
+            }
+
+            auto const inner = r1 < r2 ? e : twin;
+            edges_.push_back({
+                .min_alpha = std::min(r1, r2),
+                .max_alpha = std::max(r1, r2),
+                .edge = { triangulation.origin(inner),
+                          triangulation.target(inner) },
+            });
+        });
+
+    edges_by_min_.reserve(edges_.size());
+    edges_by_max_.reserve(edges_.size());
+    build_tree(edges_);
+}
+
+void
+AlphaShape::reset()
+{
+    min_alpha_ = 0.0f;
+    max_alpha_ = 0.0f;
+    radii_.clear();
+    triangles_.clear();
+    edges_.clear();
+    edges_by_min_.clear();
+    edges_by_max_.clear();
+    nodes_.clear();
+    centers_.clear();
+}
+
+auto
+AlphaShape::build_tree(std::span<Edge> const edges) -> index_type
+{
+    if (edges.empty())
+    {
+        return invalid_node;
+    }
+
+    // Splitting at the median lower bound keeps the tree balanced, and at
+    // least the median edge stays in the node
+    centers_.clear();
+    std::ranges::transform(
+        edges, std::back_inserter(centers_), &Edge::min_alpha);
+    auto const median = std::next(
+        centers_.begin(), static_cast<std::ptrdiff_t>(centers_.size() / 2u));
+    std::ranges::nth_element(centers_, median);
+    auto const center = *median;
+
+    auto const left_end = std::partition(edges.begin(),
+                                         edges.end(),
+                                         [&](Edge const& edge)
+                                         { return edge.max_alpha <= center; });
+    auto const middle_end =
+        std::partition(left_end,
+                       edges.end(),
+                       [&](Edge const& edge)
+                       { return edge.min_alpha <= center; });
+
+    auto const node = static_cast<index_type>(nodes_.size());
+    auto const begin = static_cast<index_type>(edges_by_min_.size());
+    auto const end = static_cast<index_type>(
+        begin + std::distance(left_end, middle_end));
+
+    edges_by_min_.insert(edges_by_min_.end(), left_end, middle_end);
+    std::ranges::sort(std::next(edges_by_min_.begin(), begin),
+                      edges_by_min_.end(),
+                      std::less{},
+                      &Edge::min_alpha);
+
+    edges_by_max_.insert(edges_by_max_.end(), left_end, middle_end);
+    std::ranges::sort(std::next(edges_by_max_.begin(), begin),
+                      edges_by_max_.end(),
+                      std::greater{},
+                      &Edge::max_alpha);
+
+    nodes_.push_back({
+        .center = center,
+        .left = invalid_node,
+        .right = invalid_node,
+        .begin = begin,
+        .end = end,
+    });
+
+    auto const left = build_tree({ edges.begin(), left_end });
+    auto const right = build_tree({ middle_end, edges.end() });
+    nodes_[node].left = left;
+    nodes_[node].right = right;
+
+    return node;
+}
+
+} // namespace pa093::algorithm::triangulation
@@ -0,0 +1,172 @@
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+#include <pa093/concurrency/job_system.hpp>
+#include <pa093/datastructure/triangulation.hpp>
+
+namespace pa093::algorithm::triangulation
+{
+
+/**
+ * Alpha shapes of a Delaunay triangulation.
+ *
+ * For a given alpha, the shape consists of the triangles with circumradius at
+ * most alpha. Building classifies every triangle and edge by its critical
+ * alpha once; the shape for any alpha is then queried in time proportional
+ * to the output (plus log n for the boundary), without retriangulating.
+ */
+class AlphaShape
+{
+public:
+    using triangulation_type = datastructure::Triangulation;
+    using index_type = triangulation_type::index_type;
+    using edge_type = triangulation_type::edge_type;
+
+    [[nodiscard]] explicit AlphaShape(
+        std::pmr::memory_resource* const resource =
+            std::pmr::get_default_resource(),
+        concurrency::JobSystem& jobs =
+            concurrency::JobSystem::instance()) noexcept
+        : jobs_{ &jobs }
+        , radii_{ resource }
+        , triangles_{ resource }
+        , edges_{ resource }
+        , edges_by_min_{ resource }
+        , edges_by_max_{ resource }
+        , nodes_{ resource }
+        , centers_{ resource }
+    {
+    }
+
+    void operator()(triangulation_type const& triangulation);
+
+    /**
+     * Smallest and largest finite critical alpha; every shape with alpha
+     * outside of this range is either empty or the whole triangulation.
+     */
+    [[nodiscard]] auto min_alpha() const noexcept -> float
+    {
+        return min_alpha_;
+    }
+
+    [[nodiscard]] auto max_alpha() const noexcept -> float
+    {
+        return max_alpha_;
+    }
+
+    /**
+     * Outputs the indices of triangles in the shape.
+     */
+    template<std::output_iterator<index_type> O>
+    auto triangles(float const alpha, O const result) const -> O
+    {
+        auto const end =
+            std::ranges::upper_bound(triangles_, alpha, {}, &Triangle::radius);
+        return std::ranges::transform(
+                   triangles_.begin(), end, result, &Triangle::index)
+            .out;
+    }
+
+    /**
+     * Outputs the boundary edges of the shape, oriented with the shape on
+     * their left.
+     */
+    template<std::output_iterator<edge_type> O>
+    auto boundary(float const alpha, O result) const -> O
+    {
+        auto node = nodes_.empty() ? invalid_node : index_type{ 0 };
+
+        while (node != invalid_node)
+        {
+            auto const& [center, left, right, begin, end] = nodes_[node];
+
+            // Every edge of the node is on the boundary at the center
+            if (alpha < center)
+            {
+                auto const edges = std::span{ edges_by_min_ }.subspan(
+                    begin, end - begin);
+                for (auto const& edge : edges)
+                {
+                    if (edge.min_alpha > alpha)
+                    {
+                        break;
+                    }
+                    *result++ = edge.edge;
+                }
+                node = left;
+            }
+            else
+            {
+                auto const edges = std::span{ edges_by_max_ }.subspan(
+                    begin, end - begin);
+                for (auto const& edge : edges)
+                {
+                    if (edge.max_alpha <= alpha)
+                    {
+                        break;
+                    }
+                    *result++ = edge.edge;
+                }
+                node = right;
+            }
+        }
+
+        return result;
+    }
+
+    void reset();
+
+private:
+    static constexpr auto invalid_node = triangulation_type::invalid_index;
+
+    struct Triangle
+    {
+        float radius;
+        index_type index;
+    };
+
+    /**
+     * An edge is on the boundary for alpha in [min_alpha, max_alpha), i.e.
+     * when exactly one of its triangles is in the shape.
+     */
+    struct Edge
+    {
+        float min_alpha;
+        float max_alpha;
+        edge_type edge;
+    };
+
+    /**
+     * Centered interval tree node; holds the edges whose interval contains
+     * the center, in [begin, end) of both edges_by_min_ (ascending) and
+     * edges_by_max_ (descending).
+     */
+    struct Node
+    {
+        float center;
+        index_type left;
+        index_type right;
+        index_type begin;
+        index_type end;
+    };
+
+    float min_alpha_ = 0.0f;
+    float max_alpha_ = 0.0f;
+    concurrency::JobSystem* jobs_;
+    std::pmr::vector<float> radii_;
+    std::pmr::vector<Triangle> triangles_;
+    std::pmr::vector<Edge> edges_;
+    std::pmr::vector<Edge> edges_by_min_;
+    std::pmr::vector<Edge> edges_by_max_;
+    std::pmr::vector<Node> nodes_;
+    std::pmr::vector<float> centers_;
+
+    auto build_tree(std::span<Edge> edges) -> index_type;
+};
+
+} // namespace pa093::algorithm::triangulation
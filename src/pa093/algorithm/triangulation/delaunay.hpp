@@ -5,15 +5,18 @@
 #include <cassert>
 #include <cmath>
 #include <concepts>
-#include <functional>
 #include <iterator>
 #include <limits>
+#include <memory_resource>
 #include <optional>
 #include <ranges>
+#include <span>
+#include <utility>
 #include <vector>
 
 #include <glm/glm.hpp>
 
+#include <pa093/algorithm/batch.hpp>
 #include <pa093/algorithm/constants.hpp>
 #include <pa093/algorithm/geometric_functions.hpp>
 
@@ -41,6 +44,15 @@ delaunay_distance(glm::vec2 const p1,
 class Delaunay
 {
 public:
+    [[nodiscard]] explicit Delaunay(
+        std::pmr::memory_resource* const resource =
+            std::pmr::get_default_resource()) noexcept
+        : points_{ resource }
+        , sides_{ resource }
+        , active_boundary_{ resource }
+    {
+    }
+
     template<std::ranges::input_range R, std::output_iterator<glm::vec2> O>
     requires std::same_as<std::ranges::range_value_t<R>, glm::vec2>
     auto operator()(R&& range, O const result) -> O
@@ -65,11 +77,8 @@ public:
 
             auto p1 = points_.front();
             // p2 is the closest point to p1
-            auto p2 = *std::ranges::min_element(
-                std::next(points_.begin()),
-                points_.end(),
-                std::less{},
-                [&](glm::vec2 const p) { return glm::distance2(p1, p); });
+            auto p2 = points_[1u + batch::closest_point(
+                                       std::span{ points_ }.subspan(1u), p1)];
 
             // p3 is the point that minimizes delaunay distance to (p1, p2)
             auto p3 = complete_triangle(p1, p2);
@@ -115,41 +124,71 @@ public:
     void reset()
     {
         points_.clear();
+        sides_.clear();
         active_boundary_.clear();
     }
 
 private:
-    std::vector<glm::vec2> points_;
-    std::vector<std::array<glm::vec2, 2u>> active_boundary_;
+    std::pmr::vector<glm::vec2> points_;
+    // Orientations of points_ relative to the edge being completed
+    std::pmr::vector<float> sides_;
+    std::pmr::vector<std::array<glm::vec2, 2u>> active_boundary_;
 
     [[nodiscard]] auto complete_triangle(glm::vec2 const p1,
-                                         glm::vec2 const p2) noexcept
+                                         glm::vec2 const p2)
         -> std::optional<glm::vec2>
     {
-        auto const left_points_end =
-            std::ranges::partition(points_,
-                                   [&](glm::vec2 const p)
-                                   {
-                                       auto m = glm::mat2{};
-                                       m[0] = p2 - p1;
-                                       m[1] = p - p1;
-                                       return glm::determinant(m) >
-                                              constants::epsilon_determinant;
-                                   })
-                .begin();
-
-        auto const match = std::ranges::min_element(
-            points_.begin(),
-            left_points_end,
-            std::less{},
-            [&](glm::vec2 const p) { return delaunay_distance(p1, p2, p); });
-
-        if (match == left_points_end)
+        sides_.resize(points_.size());
+        batch::orientations(points_, p1, p2, sides_);
+
+        auto const left_points =
+            std::span{ points_ }.first(partition_left_points());
+
+        auto const match = batch::min_delaunay_distance(left_points, p1, p2);
+        if (match == left_points.size())
         {
             return std::nullopt;
         }
 
-        return *match;
+        return left_points[match];
+    }
+
+    /**
+     * Moves the points strictly left of the edge to the front, in the same
+     * order as std::ranges::partition would; returns their count. Reads the
+     * side of every position once, before anything is swapped into it.
+     */
+    [[nodiscard]] auto partition_left_points() noexcept -> std::size_t
+    {
+        auto const is_left = [&](std::size_t const i)
+        { return sides_[i] > constants::epsilon_determinant; };
+
+        auto first = std::size_t{ 0u };
+        auto tail = points_.size();
+        while (true)
+        {
+            while (first != tail and is_left(first))
+            {
+                ++first;
+            }
+            if (first == tail)
+            {
+                return first;
+            }
+
+            --tail;
+            while (first != tail and not is_left(tail))
+            {
+                --tail;
+            }
+            if (first == tail)
+            {
+                return first;
+            }
+
+            std::swap(points_[first], points_[tail]);
+            ++first;
+        }
     }
 
     void expand_active_boundary(glm::vec2 const p1, glm::vec2 const p2)
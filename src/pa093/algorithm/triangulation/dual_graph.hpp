@@ -8,6 +8,7 @@
 #include <functional>
 #include <iterator>
 #include <limits>
+#include <memory_resource>
 #include <optional>
 #include <ranges>
 #include <vector>
@@ -26,8 +27,15 @@ namespace pa093::algorithm::triangulation
 class DualGraph
 {
 public:
-    [[nodiscard]] explicit DualGraph(float const hull_edge_length) noexcept
+    [[nodiscard]] explicit DualGraph(
+        float const hull_edge_length,
+        std::pmr::memory_resource* const resource =
+            std::pmr::get_default_resource()) noexcept
         : hull_edge_length_{ hull_edge_length }
+        , triangles_{ resource }
+        , dual_vertices_{ resource }
+        // Braces would pick the initializer_list<bool> constructor
+        , hull_edges_mask_(resource)
     {
     }
 
@@ -147,9 +155,9 @@ private:
     using edge_index_type = std::size_t;
 
     float hull_edge_length_;
-    std::vector<triangle_type> triangles_;
-    std::vector<glm::vec2> dual_vertices_;
-    std::vector<bool> hull_edges_mask_;
+    std::pmr::vector<triangle_type> triangles_;
+    std::pmr::vector<glm::vec2> dual_vertices_;
+    std::pmr::vector<bool> hull_edges_mask_;
 
     [[nodiscard]] static auto find_adjacency(triangle_type const& t1,
                                              triangle_type const& t2) noexcept
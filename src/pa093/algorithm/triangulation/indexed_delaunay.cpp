@@ -0,0 +1,781 @@
+#include <pa093/algorithm/triangulation/indexed_delaunay.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <limits>
+#include <numeric>
+#include <tuple>
+#include <utility>
+
+#include <glm/gtx/norm.hpp>
+#include <gsl/gsl_assert>
+
+#include <pa093/algorithm/constants.hpp>
+#include <pa093/algorithm/geometric_functions.hpp>
+#include <pa093/concurrency/parallel_sort.hpp>
+
+namespace pa093::algorithm::triangulation
+{
+
+namespace
+{
+
+[[nodiscard]] auto
+coincident(glm::vec2 const p1, glm::vec2 const p2) noexcept -> bool
+{
+    return glm::all(glm::epsilonEqual(p1, p2, constants::epsilon_distance));
+}
+
+[[nodiscard]] auto
+coincident(glm::ivec2 const p1, glm::ivec2 const p2) noexcept -> bool
+{
+    return p1 == p2;
+}
+
+template<typename P>
+[[nodiscard]] auto
+circumradius2(P const a, P const b, P const c) noexcept -> double
+{
+    auto const det = orientation(a, b, c);
+    if (det == 0)
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    auto const dx = static_cast<double>(b.x) - a.x;
+    auto const dy = static_cast<double>(b.y) - a.y;
+    auto const ex = static_cast<double>(c.x) - a.x;
+    auto const ey = static_cast<double>(c.y) - a.y;
+    auto const bl = dx * dx + dy * dy;
+    auto const cl = ex * ex + ey * ey;
+
+    auto const x = (ey * bl - dy * cl) / (2.0 * static_cast<double>(det));
+    auto const y = (dx * cl - ex * bl) / (2.0 * static_cast<double>(det));
+    return x * x + y * y;
+}
+
+/**
+ * True if the hull edge (p1, p2) is visible from p, i.e. p lies strictly to
+ * the right of it
+ */
+template<typename P>
+[[nodiscard]] auto
+is_visible(P const p, P const p1, P const p2) noexcept -> bool
+{
+    return orientation(p1, p2, p) < 0;
+}
+
+/**
+ * Monotonic in the angle of d, with values in [0, 1]
+ */
+template<typename V>
+[[nodiscard]] auto
+pseudo_angle(V const d) noexcept -> float
+{
+    using scalar_type = typename V::value_type;
+
+    auto const l = std::abs(d.x) + std::abs(d.y);
+    if (l == scalar_type{ 0 })
+    {
+        return 0.0f;
+    }
+
+    auto const p = d.x / l;
+    return static_cast<float>(
+        (d.y > scalar_type{ 0 } ? scalar_type{ 3 } - p : scalar_type{ 1 } + p) /
+        scalar_type{ 4 });
+}
+
+/**
+ * Center of the seed triangle, around which the points are inserted
+ */
+[[nodiscard]] auto
+seed_center(glm::vec2 const a, glm::vec2 const b, glm::vec2 const c) noexcept
+    -> glm::vec2
+{
+    return circumcircle_center(a, b, c).value_or((a + b + c) / 3.0f);
+}
+
+[[nodiscard]] auto
+seed_center(glm::ivec2 const a, glm::ivec2, glm::ivec2) noexcept -> glm::ivec2
+{
+    // A grid point, so that distances from it are exact; the sweep only
+    // needs every point to be at least as far as the points before it
+    return a;
+}
+
+/**
+ * Squared distance, evaluated in double precision
+ */
+[[nodiscard]] auto
+distance2(glm::vec2 const p1, glm::vec2 const p2) noexcept -> double
+{
+    return glm::distance2(glm::dvec2{ p1 }, glm::dvec2{ p2 });
+}
+
+/**
+ * Squared distance of grid points; exact for coordinates within
+ * constants::max_grid_coordinate
+ */
+[[nodiscard]] auto
+distance2(glm::ivec2 const p1, glm::ivec2 const p2) noexcept -> std::int64_t
+{
+    auto const dx = std::int64_t{ p1.x } - p2.x;
+    auto const dy = std::int64_t{ p1.y } - p2.y;
+    return dx * dx + dy * dy;
+}
+
+/**
+ * Position of p along the line through origin with the given direction,
+ * scaled by the length of the direction
+ */
+[[nodiscard]] auto
+projection(glm::vec2 const p,
+           glm::vec2 const origin,
+           glm::vec2 const direction) noexcept -> float
+{
+    return glm::dot(p - origin, direction);
+}
+
+[[nodiscard]] auto
+projection(glm::ivec2 const p,
+           glm::ivec2 const origin,
+           glm::ivec2 const direction) noexcept -> std::int64_t
+{
+    return (std::int64_t{ p.x } - origin.x) * direction.x +
+           (std::int64_t{ p.y } - origin.y) * direction.y;
+}
+
+} // namespace
+
+template<typename T>
+auto
+BasicIndexedDelaunay<T>::triangulate(triangulation_type& triangulation)
+    -> bool
+{
+    reset();
+    triangulation.clear_triangles();
+
+    auto const points = std::as_const(triangulation).points();
+    auto const n = static_cast<index_type>(points.size());
+
+    if (n == 0u)
+    {
+        return true;
+    }
+
+    if constexpr (std::integral<T>)
+    {
+        // The exact predicates rely on the coordinate range
+        constexpr auto limit = point_type(constants::max_grid_coordinate);
+        Expects(std::ranges::all_of(
+            points,
+            [&](point_type const point)
+            {
+                return glm::all(glm::lessThanEqual(-limit, point)) and
+                       glm::all(glm::lessThanEqual(point, limit));
+            }));
+    }
+
+    // Pick the seed triangle: i0 closest to the center of the bounding box,
+    // i1 closest to i0, and i2 forming the smallest circumcircle with them.
+    auto min = points[0];
+    auto max = points[0];
+    for (auto const point : points)
+    {
+        min = glm::min(min, point);
+        max = glm::max(max, point);
+    }
+    auto const bounds_center = min + (max - min) / T{ 2 };
+
+    auto const indices = std::views::iota(index_type{ 0 }, n);
+
+    auto const i0 = *std::ranges::min_element(
+        indices,
+        std::less{},
+        [&](index_type const i)
+        { return distance2(points[i], bounds_center); });
+
+    auto i1 = invalid_index;
+    auto min_dist = std::numeric_limits<distance_type>::max();
+    for (auto const i : indices)
+    {
+        if (coincident(points[i], points[i0]))
+        {
+            continue;
+        }
+        if (auto const d = distance2(points[i], points[i0]); d < min_dist)
+        {
+            i1 = i;
+            min_dist = d;
+        }
+    }
+
+    auto i2 = invalid_index;
+    if constexpr (std::integral<T>)
+    {
+        // The closest point not collinear with i0 and i1, so that the seed
+        // triangle contains no other point. With the exact distance order,
+        // every point is then outside the hull when it is inserted.
+        min_dist = std::numeric_limits<distance_type>::max();
+        for (auto const i : indices)
+        {
+            if (i1 == invalid_index or
+                orientation(points[i0], points[i1], points[i]) == 0)
+            {
+                continue;
+            }
+            if (auto const d = distance2(points[i], points[i0]); d < min_dist)
+            {
+                i2 = i;
+                min_dist = d;
+            }
+        }
+    }
+    else
+    {
+        auto min_radius = std::numeric_limits<double>::infinity();
+        for (auto const i : indices)
+        {
+            if (i1 == invalid_index or i == i0 or i == i1)
+            {
+                continue;
+            }
+            if (auto const r = circumradius2(points[i0], points[i1], points[i]);
+                r < min_radius)
+            {
+                i2 = i;
+                min_radius = r;
+            }
+        }
+    }
+
+    if (i2 == invalid_index)
+    {
+        // Fewer than three distinct points, or all of them collinear
+        triangulate_collinear(triangulation);
+        return true;
+    }
+
+    if (orientation(points[i0], points[i1], points[i2]) < 0)
+    {
+        std::swap(i1, i2);
+    }
+
+    center_ = seed_center(points[i0], points[i1], points[i2]);
+
+    // Sort the points by distance from the seed center. Ties are broken by
+    // position, so that coincident points end up adjacent, with seeds first
+    // among them.
+    auto const is_seed = [&](index_type const i)
+    { return i == i0 or i == i1 or i == i2; };
+
+    ids_.resize(n);
+    std::iota(ids_.begin(), ids_.end(), index_type{ 0 });
+    dists_.resize(n);
+    for (auto const i : indices)
+    {
+        dists_[i] = distance2(points[i], center_);
+    }
+    concurrency::parallel_sort(*jobs_,
+                               ids_,
+                               [&](index_type const a, index_type const b)
+                               {
+                                   return std::tuple{ dists_[a],
+                                                      points[a].x,
+                                                      points[a].y,
+                                                      not is_seed(a) } <
+                                          std::tuple{ dists_[b],
+                                                      points[b].x,
+                                                      points[b].y,
+                                                      not is_seed(b) };
+                               });
+
+    // Initialize the hull with the seed triangle
+    hash_size_ = static_cast<std::size_t>(std::ceil(std::sqrt(n)));
+    hull_prev_.assign(n, invalid_index);
+    hull_next_.assign(n, invalid_index);
+    hull_tri_.assign(n, invalid_index);
+    hull_hash_.assign(hash_size_, invalid_index);
+
+    hull_start_ = i0;
+    auto hull_size = std::size_t{ 3 };
+
+    hull_next_[i0] = hull_prev_[i2] = i1;
+    hull_next_[i1] = hull_prev_[i0] = i2;
+    hull_next_[i2] = hull_prev_[i1] = i0;
+
+    hull_tri_[i0] = 0u;
+    hull_tri_[i1] = 1u;
+    hull_tri_[i2] = 2u;
+
+    hull_hash_[hash_key(points[i0])] = i0;
+    hull_hash_[hash_key(points[i1])] = i1;
+    hull_hash_[hash_key(points[i2])] = i2;
+
+    triangulation.reserve_triangles(n > 2u ? 2u * n - 5u : 1u);
+    add_triangle(triangulation,
+                 i0,
+                 i1,
+                 i2,
+                 invalid_index,
+                 invalid_index,
+                 invalid_index);
+
+    auto previous = invalid_index;
+    auto complete = true;
+
+    for (auto const i : ids_)
+    {
+        auto const p = points[i];
+
+        if (is_seed(i))
+        {
+            previous = i;
+            continue;
+        }
+
+        if (previous != invalid_index and coincident(p, points[previous]))
+        {
+            triangulation.add_duplicate(i, previous);
+            continue;
+        }
+        previous = i;
+
+        // Find a visible edge on the hull using the edge hash
+        auto start = invalid_index;
+        auto const key = hash_key(p);
+        for (auto j = std::size_t{ 0 }; j < hash_size_; ++j)
+        {
+            start = hull_hash_[(key + j) % hash_size_];
+            if (start != invalid_index and start != hull_next_[start])
+            {
+                break;
+            }
+        }
+
+        start = hull_prev_[start];
+        auto e = start;
+        while (not is_visible(p, points[e], points[hull_next_[e]]))
+        {
+            e = hull_next_[e];
+            if (e == start)
+            {
+                e = invalid_index;
+                break;
+            }
+        }
+
+        if (e == invalid_index)
+        {
+            // The point is not outside the hull. It lies inside the seed
+            // triangle, or its distance was rounded below that of nearby
+            // hull points; neither happens with grid points.
+            if constexpr (std::floating_point<T>)
+            {
+                switch (insert_inside(triangulation, i, hull_tri_[start]))
+                {
+                    case InsideInsertion::interior:
+                        break;
+                    case InsideInsertion::hull:
+                        ++hull_size;
+                        break;
+                    case InsideInsertion::duplicate:
+                        // Further coincident points duplicate the same
+                        // vertex
+                        previous = triangulation.duplicates().back()[1];
+                        break;
+                    case InsideInsertion::failed:
+                        previous = invalid_index;
+                        complete = false;
+                        break;
+                }
+            }
+            else
+            {
+                // Unreachable with the exact predicates; the point is left
+                // out if contract checks are off
+                Expects(false);
+                previous = invalid_index;
+                complete = false;
+            }
+            continue;
+        }
+
+        // Add the first triangle from the point
+        auto t = add_triangle(triangulation,
+                              e,
+                              i,
+                              hull_next_[e],
+                              invalid_index,
+                              invalid_index,
+                              hull_tri_[e]);
+
+        // Recursively flip triangles from the point until they satisfy the
+        // Delaunay condition
+        hull_tri_[i] = legalize(triangulation, t + 2u);
+        // Keep track of boundary triangles on the hull
+        hull_tri_[e] = t;
+        ++hull_size;
+
+        // Walk forward through the hull, adding more triangles and flipping
+        auto next = hull_next_[e];
+        for (auto q = hull_next_[next];
+             is_visible(p, points[next], points[q]);
+             q = hull_next_[next])
+        {
+            t = add_triangle(triangulation,
+                             next,
+                             i,
+                             q,
+                             hull_tri_[i],
+                             invalid_index,
+                             hull_tri_[next]);
+            hull_tri_[i] = legalize(triangulation, t + 2u);
+            // Mark as removed
+            hull_next_[next] = next;
+            --hull_size;
+            next = q;
+        }
+
+        // Walk backward from the other side, adding more triangles and
+        // flipping
+        if (e == start)
+        {
+            for (auto q = hull_prev_[e]; is_visible(p, points[q], points[e]);
+                 q = hull_prev_[e])
+            {
+                t = add_triangle(triangulation,
+                                 q,
+                                 i,
+                                 e,
+                                 invalid_index,
+                                 hull_tri_[e],
+                                 hull_tri_[q]);
+                legalize(triangulation, t + 2u);
+                hull_tri_[q] = t;
+                // Mark as removed
+                hull_next_[e] = e;
+                --hull_size;
+                e = q;
+            }
+        }
+
+        // Update the hull indices
+        hull_start_ = hull_prev_[i] = e;
+        hull_next_[e] = hull_prev_[next] = i;
+        hull_next_[i] = next;
+
+        // Save the two new edges in the hash table
+        hull_hash_[hash_key(p)] = i;
+        hull_hash_[hash_key(points[e])] = e;
+    }
+
+    // Reuse the id buffer for the hull sequence
+    ids_.clear();
+    for (auto e = hull_start_; ids_.size() < hull_size; e = hull_next_[e])
+    {
+        ids_.push_back(e);
+    }
+    triangulation.set_hull(ids_);
+    triangulation.update_vertex_halfedges();
+
+    return complete;
+}
+
+template<typename T>
+void
+BasicIndexedDelaunay<T>::reset()
+{
+    center_ = {};
+    hash_size_ = 0u;
+    hull_start_ = invalid_index;
+    ids_.clear();
+    dists_.clear();
+    hull_prev_.clear();
+    hull_next_.clear();
+    hull_tri_.clear();
+    hull_hash_.clear();
+    edge_stack_.clear();
+}
+
+template<typename T>
+auto
+BasicIndexedDelaunay<T>::hash_key(point_type const point) const noexcept
+    -> std::size_t
+{
+    auto const angle = pseudo_angle(metric_point_type{ point } -
+                                    metric_point_type{ center_ });
+    return static_cast<std::size_t>(
+               std::floor(angle * static_cast<float>(hash_size_))) %
+           hash_size_;
+}
+
+template<typename T>
+void
+BasicIndexedDelaunay<T>::triangulate_collinear(
+    triangulation_type& triangulation)
+{
+    auto const points = triangulation.points();
+    auto const n = static_cast<index_type>(points.size());
+
+    // Order the points along the line they lie on
+    auto const origin = points[0];
+    auto direction = point_type{ 1, 0 };
+    for (auto const point : points)
+    {
+        if (not coincident(point, origin))
+        {
+            direction = point - origin;
+            break;
+        }
+    }
+
+    ids_.resize(n);
+    std::iota(ids_.begin(), ids_.end(), index_type{ 0 });
+    std::ranges::sort(ids_,
+                      std::less{},
+                      [&](index_type const i)
+                      {
+                          return std::tuple{
+                              projection(points[i], origin, direction),
+                              points[i].x,
+                              points[i].y,
+                          };
+                      });
+
+    // Keep the first of each group of coincident points
+    auto hull_end = ids_.begin();
+    for (auto const i : ids_)
+    {
+        if (hull_end != ids_.begin() and
+            coincident(points[i], points[*std::prev(hull_end)]))
+        {
+            triangulation.add_duplicate(i, *std::prev(hull_end));
+        }
+        else
+        {
+            *hull_end++ = i;
+        }
+    }
+    ids_.erase(hull_end, ids_.end());
+
+    triangulation.set_hull(ids_);
+    triangulation.update_vertex_halfedges();
+}
+
+template<typename T>
+auto
+BasicIndexedDelaunay<T>::add_triangle(triangulation_type& triangulation,
+                                      index_type const i0,
+                                      index_type const i1,
+                                      index_type const i2,
+                                      index_type const a,
+                                      index_type const b,
+                                      index_type const c) -> index_type
+{
+    auto const t = triangulation.add_triangle(i0, i1, i2);
+    triangulation.link(t, a);
+    triangulation.link(t + 1u, b);
+    triangulation.link(t + 2u, c);
+    return t;
+}
+
+template<typename T>
+auto
+BasicIndexedDelaunay<T>::legalize(triangulation_type& triangulation,
+                                  index_type a) -> index_type
+{
+    constexpr auto next_halfedge = &triangulation_type::next_halfedge;
+    constexpr auto prev_halfedge = &triangulation_type::prev_halfedge;
+
+    auto const points = triangulation.points();
+    auto ar = invalid_index;
+
+    edge_stack_.clear();
+
+    while (true)
+    {
+        auto const b = triangulation.twin(a);
+        ar = prev_halfedge(a);
+
+        auto const p0 = points[triangulation.origin(ar)];
+        auto const pr = points[triangulation.origin(a)];
+        auto const pl = points[triangulation.origin(next_halfedge(a))];
+
+        if (b != invalid_index and
+            in_circle(
+                p0, pr, pl, points[triangulation.origin(prev_halfedge(b))]) >
+                0)
+        {
+            auto const bl = prev_halfedge(b);
+
+            if (triangulation.is_hull_edge(bl))
+            {
+                // The flip moves the hull edge bl to a (rare); fix the
+                // reference to it
+                auto e = hull_start_;
+                do
+                {
+                    if (hull_tri_[e] == bl)
+                    {
+                        hull_tri_[e] = a;
+                        break;
+                    }
+                    e = hull_prev_[e];
+                } while (e != hull_start_);
+            }
+
+            triangulation.flip(a);
+            // The edge a now faces a new triangle; check it again, and
+            // the other side's outer edge later
+            edge_stack_.push_back(next_halfedge(b));
+        }
+        else
+        {
+            if (edge_stack_.empty())
+            {
+                break;
+            }
+            a = edge_stack_.back();
+            edge_stack_.pop_back();
+        }
+    }
+
+    return ar;
+}
+
+template<typename T>
+auto
+BasicIndexedDelaunay<T>::insert_inside(triangulation_type& triangulation,
+                                       index_type const i,
+                                       index_type e) -> InsideInsertion
+requires std::floating_point<T>
+{
+    constexpr auto next_halfedge = &triangulation_type::next_halfedge;
+    constexpr auto prev_halfedge = &triangulation_type::prev_halfedge;
+
+    auto const points = triangulation.points();
+    auto const p = points[i];
+
+    // Visibility walk: cross any edge that p lies strictly beyond. It
+    // terminates on Delaunay triangulations, so the step limit is only ever
+    // reached through rounding.
+    auto located = false;
+    for (auto steps = triangulation.num_triangles(); steps > 0u; --steps)
+    {
+        auto const halfedges =
+            std::array{ e, next_halfedge(e), prev_halfedge(e) };
+        auto const beyond = std::ranges::find_if(
+            halfedges,
+            [&](index_type const h)
+            {
+                return not triangulation.is_hull_edge(h) and
+                       is_visible(p,
+                                  points[triangulation.origin(h)],
+                                  points[triangulation.target(h)]);
+            });
+
+        if (beyond == halfedges.end())
+        {
+            located = true;
+            break;
+        }
+        e = triangulation.twin(*beyond);
+    }
+
+    if (not located)
+    {
+        // Rounding made the walk cycle; scan all triangles for one that p
+        // lies beyond no edge of
+        auto const triangles =
+            std::views::iota(index_type{ 0 },
+                             static_cast<index_type>(
+                                 triangulation.num_triangles()));
+        auto const containing = std::ranges::find_if(
+            triangles,
+            [&](index_type const t)
+            {
+                auto const [i1, i2, i3] = triangulation.triangle(t);
+                return not is_visible(p, points[i1], points[i2]) and
+                       not is_visible(p, points[i2], points[i3]) and
+                       not is_visible(p, points[i3], points[i1]);
+            });
+
+        if (containing == triangles.end())
+        {
+            return InsideInsertion::failed;
+        }
+        e = 3u * *containing;
+    }
+
+    auto const halfedges = std::array{ e, next_halfedge(e), prev_halfedge(e) };
+
+    for (auto const h : halfedges)
+    {
+        if (coincident(p, points[triangulation.origin(h)]))
+        {
+            triangulation.add_duplicate(i, triangulation.origin(h));
+            return InsideInsertion::duplicate;
+        }
+    }
+
+    auto const hull_edge = std::ranges::find_if(
+        halfedges,
+        [&](index_type const h)
+        {
+            return triangulation.is_hull_edge(h) and
+                   orientation(points[triangulation.origin(h)],
+                               points[triangulation.target(h)],
+                               p) == 0;
+        });
+
+    if (hull_edge != halfedges.end())
+    {
+        // On the hull edge (a, b): split it, and put p between a and b on
+        // the hull
+        auto const a = triangulation.origin(*hull_edge);
+        auto const b = triangulation.target(*hull_edge);
+        auto const outer = prev_halfedge(*hull_edge);
+
+        auto const n = triangulation.split_hull_edge(*hull_edge, i);
+        if (triangulation.is_hull_edge(n + 1u))
+        {
+            hull_tri_[b] = n + 1u;
+        }
+
+        hull_next_[a] = hull_prev_[b] = i;
+        hull_prev_[i] = a;
+        hull_next_[i] = b;
+        hull_hash_[hash_key(p)] = i;
+
+        legalize(triangulation, outer);
+        // Flips may move the hull edge from p, as in the sweep
+        hull_tri_[i] = legalize(triangulation, n + 1u);
+        return InsideInsertion::hull;
+    }
+
+    // If p lies on an internal edge, one of the triangles is degenerate.
+    // Legalization flips it away, as its circumcircle is the half-plane
+    // containing the point opposite to it.
+    auto const n = triangulation.split_triangle(e, i);
+    for (auto const h : { n, n + 3u })
+    {
+        if (triangulation.is_hull_edge(h))
+        {
+            hull_tri_[triangulation.origin(h)] = h;
+        }
+    }
+
+    legalize(triangulation, e);
+    legalize(triangulation, n);
+    legalize(triangulation, n + 3u);
+    return InsideInsertion::interior;
+}
+
+template class BasicIndexedDelaunay<float>;
+template class BasicIndexedDelaunay<std::int32_t>;
+
+} // namespace pa093::algorithm::triangulation
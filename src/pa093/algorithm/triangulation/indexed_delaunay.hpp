@@ -0,0 +1,155 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory_resource>
+#include <ranges>
+#include <type_traits>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <pa093/concurrency/job_system.hpp>
+#include <pa093/datastructure/triangulation.hpp>
+
+namespace pa093::algorithm::triangulation
+{
+
+/**
+ * Delaunay triangulation by radial sweep-hull insertion with Lawson flips,
+ * in O(n log n) expected time.
+ *
+ * Points are inserted in order of distance from the circumcenter of a seed
+ * triangle, so that every point lies outside the current convex hull; the
+ * visible part of the hull is located through an angular hash of hull
+ * points.
+ *
+ * With integer grid coordinates (GridIndexedDelaunay), the orientation and
+ * in-circle tests are exact and only identical points are coincident, so
+ * the result does not depend on any epsilon. Points are then inserted in
+ * order of their exact distance from the first seed point.
+ */
+template<typename T>
+class BasicIndexedDelaunay
+{
+public:
+    using triangulation_type = datastructure::BasicTriangulation<T>;
+    using point_type = typename triangulation_type::point_type;
+    using index_type = typename triangulation_type::index_type;
+
+    [[nodiscard]] explicit BasicIndexedDelaunay(
+        std::pmr::memory_resource* const resource =
+            std::pmr::get_default_resource(),
+        concurrency::JobSystem& jobs =
+            concurrency::JobSystem::instance()) noexcept
+        : jobs_{ &jobs }
+        , ids_{ resource }
+        , dists_{ resource }
+        , hull_prev_{ resource }
+        , hull_next_{ resource }
+        , hull_tri_{ resource }
+        , hull_hash_{ resource }
+        , edge_stack_{ resource }
+    {
+    }
+
+    template<std::ranges::input_range R>
+    requires std::same_as<std::ranges::range_value_t<R>, point_type>
+    auto operator()(R&& range, triangulation_type& triangulation) -> bool
+    {
+        return (*this)(
+            std::ranges::begin(range), std::ranges::end(range), triangulation);
+    }
+
+    template<std::input_iterator I, std::sentinel_for<I> S>
+    requires std::same_as<std::iter_value_t<I>, point_type>
+    auto operator()(I const first,
+                    S const last,
+                    triangulation_type& triangulation) -> bool
+    {
+        triangulation.assign_points(first, last);
+        return triangulate(triangulation);
+    }
+
+    /**
+     * Triangulates the points already stored in the triangulation,
+     * discarding any existing triangles.
+     *
+     * Every point becomes a vertex or a duplicate of a coincident vertex.
+     * Returns false if rounding left some points in no triangle; those are
+     * missing from the otherwise valid triangulation. This cannot happen
+     * with grid points.
+     */
+    auto triangulate(triangulation_type& triangulation) -> bool;
+
+    void reset();
+
+private:
+    static constexpr auto invalid_index = triangulation_type::invalid_index;
+
+    // Angles of grid points are measured in double precision
+    using metric_point_type =
+        std::conditional_t<std::floating_point<T>, point_type, glm::dvec2>;
+    // Squared distances of grid points are exact
+    using distance_type =
+        std::conditional_t<std::floating_point<T>, double, std::int64_t>;
+
+    point_type center_ = {};
+    std::size_t hash_size_ = 0u;
+    index_type hull_start_ = invalid_index;
+    concurrency::JobSystem* jobs_;
+    std::pmr::vector<index_type> ids_;
+    std::pmr::vector<distance_type> dists_;
+    std::pmr::vector<index_type> hull_prev_;
+    std::pmr::vector<index_type> hull_next_;
+    std::pmr::vector<index_type> hull_tri_;
+    std::pmr::vector<index_type> hull_hash_;
+    std::pmr::vector<index_type> edge_stack_;
+
+    [[nodiscard]] auto hash_key(point_type point) const noexcept
+        -> std::size_t;
+
+    void triangulate_collinear(triangulation_type& triangulation);
+
+    auto add_triangle(triangulation_type& triangulation,
+                      index_type i0,
+                      index_type i1,
+                      index_type i2,
+                      index_type a,
+                      index_type b,
+                      index_type c) -> index_type;
+
+    auto legalize(triangulation_type& triangulation, index_type a)
+        -> index_type;
+
+    enum class InsideInsertion
+    {
+        interior,
+        /** Inserted on a hull edge, as a new hull point */
+        hull,
+        duplicate,
+        /** In no triangle, through rounding */
+        failed,
+    };
+
+    /**
+     * Inserts point i, which no hull edge is visible from, into the
+     * triangle containing it, walking there from half-edge e. Grid points
+     * never need it.
+     */
+    auto insert_inside(triangulation_type& triangulation,
+                       index_type i,
+                       index_type e) -> InsideInsertion
+    requires std::floating_point<T>;
+};
+
+using IndexedDelaunay = BasicIndexedDelaunay<float>;
+/**
+ * Exact triangulation of grid points with coordinates within
+ * constants::max_grid_coordinate
+ */
+using GridIndexedDelaunay = BasicIndexedDelaunay<std::int32_t>;
+
+} // namespace pa093::algorithm::triangulation
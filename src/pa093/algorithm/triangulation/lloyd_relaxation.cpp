@@ -0,0 +1,221 @@
+#include <pa093/algorithm/triangulation/lloyd_relaxation.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <utility>
+
+#include <glm/gtx/norm.hpp>
+
+#include <pa093/algorithm/geometric_functions.hpp>
+#include <pa093/concurrency/parallel_for.hpp>
+
+namespace pa093::algorithm::triangulation
+{
+
+auto
+LloydRelaxation::relax(triangulation_type& triangulation,
+                       std::function<bool()> const& cancelled) -> std::size_t
+{
+    reset();
+
+    auto const sites = triangulation.points();
+    num_sites_ = static_cast<index_type>(sites.size());
+
+    // Surround everything with a frame whose distance from the bounds
+    // exceeds the distance of any point in the bounds to its nearest site
+    auto min = bounds_min_;
+    auto max = bounds_max_;
+    for (auto const site : sites)
+    {
+        min = glm::min(min, site);
+        max = glm::max(max, site);
+    }
+    auto const margin = glm::vec2(glm::distance(min, max));
+    min -= margin;
+    max += margin;
+
+    working_points_.assign(sites.begin(), sites.end());
+    working_points_.insert(working_points_.end(),
+                           {
+                               min,
+                               { max.x, min.y },
+                               max,
+                               { min.x, max.y },
+                           });
+    delaunay_(working_points_, working_triangulation_);
+
+    auto iteration = std::size_t{ 0 };
+
+    while (iteration < max_iterations_)
+    {
+        if (cancelled and cancelled())
+        {
+            return iteration;
+        }
+
+        cells_(working_triangulation_, cell_polygons_);
+
+        // Target the cell centroids; frame points stay
+        auto const points = working_triangulation_.points();
+        previous_points_.resize(num_sites_);
+        target_points_.resize(num_sites_);
+        chunk_max_displacements_.assign(concurrency::max_chunk_count(*jobs_),
+                                        0.0f);
+
+        concurrency::parallel_for_chunks(
+            *jobs_,
+            num_sites_,
+            [&](std::size_t const chunk,
+                std::size_t const begin,
+                std::size_t const end)
+            {
+                auto max_displacement2 = 0.0f;
+
+                for (auto i = begin; i < end; ++i)
+                {
+                    auto const centroid =
+                        polygon_centroid(cell_polygons_.polygon(i))
+                            .value_or(points[i]);
+                    max_displacement2 = std::max(
+                        max_displacement2, glm::distance2(points[i], centroid));
+                    target_points_[i] = centroid;
+                }
+
+                chunk_max_displacements_[chunk] = max_displacement2;
+            });
+
+        max_displacement_ =
+            std::sqrt(std::ranges::max(chunk_max_displacements_));
+        ++iteration;
+
+        // Move the sites and restore the Delaunay property
+        step_halvings_.assign(num_sites_, 0u);
+        pending_moves_.resize(num_sites_);
+        std::iota(
+            pending_moves_.begin(), pending_moves_.end(), index_type{ 0 });
+
+        for (auto round = 0u;
+             round < max_move_rounds and not pending_moves_.empty();
+             ++round)
+        {
+            apply_pending_moves();
+
+            if (not repair_(working_triangulation_))
+            {
+                // Coincident sites separated, or the flips did not converge
+                // on degenerate input
+                std::ranges::copy(target_points_, points.begin());
+                delaunay_.triangulate(working_triangulation_);
+                ++num_rebuilds_;
+                break;
+            }
+        }
+
+        if (max_displacement_ < convergence_threshold_)
+        {
+            break;
+        }
+    }
+
+    auto const relaxed_sites =
+        std::as_const(working_triangulation_).points().first(num_sites_);
+    std::ranges::copy(relaxed_sites, sites.begin());
+    delaunay_.triangulate(triangulation);
+
+    return iteration;
+}
+
+void
+LloydRelaxation::apply_pending_moves()
+{
+    auto const points = working_triangulation_.points();
+    moved_flags_.resize(num_sites_, false);
+    step_halvings_.resize(num_sites_, 0u);
+
+    for (auto const i : pending_moves_)
+    {
+        auto const step = 1.0f / static_cast<float>(1u << step_halvings_[i]);
+
+        previous_points_[i] = points[i];
+        points[i] += (target_points_[i] - points[i]) * step;
+        moved_flags_[i] = true;
+    }
+
+    // Revert moves until no triangle around a moved site is inverted. This
+    // terminates, since the triangulation was valid before this round.
+    reverted_moves_.clear();
+    vertex_stack_.assign(pending_moves_.begin(), pending_moves_.end());
+
+    auto const revert = [&](index_type const i)
+    {
+        if (i < num_sites_ and moved_flags_[i])
+        {
+            points[i] = previous_points_[i];
+            moved_flags_[i] = false;
+            reverted_moves_.push_back(i);
+            vertex_stack_.push_back(i);
+        }
+    };
+
+    while (not vertex_stack_.empty())
+    {
+        auto const v = vertex_stack_.back();
+        vertex_stack_.pop_back();
+
+        working_triangulation_.for_each_outgoing(
+            v,
+            [&](index_type const e)
+            {
+                auto const [i1, i2, i3] = working_triangulation_.triangle(
+                    triangulation_type::triangle_of(e));
+
+                if (orientation(points[i1], points[i2], points[i3]) <= 0.0)
+                {
+                    revert(i1);
+                    revert(i2);
+                    revert(i3);
+                }
+            });
+    }
+
+    // Reverted sites retry with half the step; sites that only made a
+    // partial step retry the full remaining distance after the flips.
+    for (auto const i : reverted_moves_)
+    {
+        step_halvings_[i] = std::min(step_halvings_[i] + 1u, max_step_halvings);
+    }
+    for (auto const i : pending_moves_)
+    {
+        if (moved_flags_[i])
+        {
+            moved_flags_[i] = false;
+
+            if (std::exchange(step_halvings_[i], 0u) > 0u)
+            {
+                reverted_moves_.push_back(i);
+            }
+        }
+    }
+
+    std::swap(pending_moves_, reverted_moves_);
+}
+
+void
+LloydRelaxation::reset()
+{
+    delaunay_.reset();
+    repair_.reset();
+    cells_.reset();
+    previous_points_.clear();
+    target_points_.clear();
+    pending_moves_.clear();
+    reverted_moves_.clear();
+    moved_flags_.clear();
+    step_halvings_.clear();
+    chunk_max_displacements_.clear();
+    max_displacement_ = 0.0f;
+    num_rebuilds_ = 0u;
+}
+
+} // namespace pa093::algorithm::triangulation
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory_resource>
+#include <ranges>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <pa093/concurrency/job_system.hpp>
+#include <pa093/algorithm/triangulation/indexed_delaunay.hpp>
+#include <pa093/algorithm/triangulation/repair_delaunay.hpp>
+#include <pa093/algorithm/triangulation/voronoi_cells.hpp>
+#include <pa093/datastructure/polygon_set.hpp>
+#include <pa093/datastructure/triangulation.hpp>
+
+namespace pa093::algorithm::triangulation
+{
+
+/**
+ * Lloyd's algorithm: repeatedly moves every site to the centroid of its
+ * Voronoi cell (clipped to a rectangle), converging to a centroidal Voronoi
+ * tessellation.
+ *
+ * Iterations run on a working triangulation that additionally contains four
+ * frame points, far enough from the rectangle that they never affect the
+ * clipped cells. The frame keeps the convex hull fixed, so the working
+ * triangulation is kept between iterations and repaired by edge flips after
+ * the sites move. Moves that would invert a triangle are retried in shorter
+ * steps after further flip rounds instead of forcing a rebuild. The output
+ * triangulation is rebuilt once at the end.
+ */
+class LloydRelaxation
+{
+public:
+    using triangulation_type = datastructure::Triangulation;
+
+    [[nodiscard]] LloydRelaxation(
+        glm::vec2 const bounds_min,
+        glm::vec2 const bounds_max,
+        float const convergence_threshold,
+        std::size_t const max_iterations,
+        std::pmr::memory_resource* const resource =
+            std::pmr::get_default_resource(),
+        concurrency::JobSystem& jobs =
+            concurrency::JobSystem::instance()) noexcept
+        : bounds_min_{ bounds_min }
+        , bounds_max_{ bounds_max }
+        , convergence_threshold_{ convergence_threshold }
+        , max_iterations_{ max_iterations }
+        , jobs_{ &jobs }
+        , delaunay_{ resource, jobs }
+        , repair_{ resource }
+        , cells_{ bounds_min, bounds_max, resource, jobs }
+        , working_points_{ resource }
+        , previous_points_{ resource }
+        , target_points_{ resource }
+        , pending_moves_{ resource }
+        , reverted_moves_{ resource }
+        , vertex_stack_{ resource }
+        // Braces would pick the initializer_list<bool> constructor
+        , moved_flags_(resource)
+        , step_halvings_{ resource }
+        , chunk_max_displacements_{ resource }
+    {
+    }
+
+    template<std::ranges::input_range R>
+    requires std::same_as<std::ranges::range_value_t<R>, glm::vec2>
+    auto operator()(R&& range,
+                    triangulation_type& triangulation,
+                    std::function<bool()> const& cancelled = {})
+        -> std::size_t
+    {
+        return (*this)(std::ranges::begin(range),
+                       std::ranges::end(range),
+                       triangulation,
+                       cancelled);
+    }
+
+    template<std::input_iterator I, std::sentinel_for<I> S>
+    requires std::same_as<std::iter_value_t<I>, glm::vec2>
+    auto operator()(I const first,
+                    S const last,
+                    triangulation_type& triangulation,
+                    std::function<bool()> const& cancelled = {})
+        -> std::size_t
+    {
+        delaunay_(first, last, triangulation);
+        return relax(triangulation, cancelled);
+    }
+
+    /**
+     * Relaxes the points of a Delaunay triangulation in place, until the
+     * largest site displacement in an iteration drops below the convergence
+     * threshold or the iteration limit is reached. Returns the number of
+     * iterations performed.
+     *
+     * cancelled(), if given, is polled before every iteration; once it
+     * returns true, the relaxation stops and leaves the triangulation
+     * unchanged.
+     */
+    auto relax(triangulation_type& triangulation,
+               std::function<bool()> const& cancelled = {}) -> std::size_t;
+
+    /**
+     * Largest site displacement in the last iteration
+     */
+    [[nodiscard]] auto max_displacement() const noexcept -> float
+    {
+        return max_displacement_;
+    }
+
+    /**
+     * Number of times the working triangulation had to be rebuilt instead of
+     * repaired in the last relaxation
+     */
+    [[nodiscard]] auto num_rebuilds() const noexcept -> std::size_t
+    {
+        return num_rebuilds_;
+    }
+
+    void reset();
+
+private:
+    using index_type = triangulation_type::index_type;
+
+    /**
+     * Attempts to apply deferred moves after each flip repair
+     */
+    static constexpr auto max_move_rounds = 8u;
+    static constexpr auto max_step_halvings = 8u;
+
+    glm::vec2 bounds_min_;
+    glm::vec2 bounds_max_;
+    float convergence_threshold_;
+    std::size_t max_iterations_;
+    concurrency::JobSystem* jobs_;
+    IndexedDelaunay delaunay_;
+    RepairDelaunay repair_;
+    VoronoiCells cells_;
+    triangulation_type working_triangulation_;
+    datastructure::PolygonSet cell_polygons_;
+    std::pmr::vector<glm::vec2> working_points_;
+    std::pmr::vector<glm::vec2> previous_points_;
+    std::pmr::vector<glm::vec2> target_points_;
+    std::pmr::vector<index_type> pending_moves_;
+    std::pmr::vector<index_type> reverted_moves_;
+    std::pmr::vector<index_type> vertex_stack_;
+    std::pmr::vector<bool> moved_flags_;
+    std::pmr::vector<unsigned> step_halvings_;
+    index_type num_sites_ = 0u;
+    std::pmr::vector<float> chunk_max_displacements_;
+    float max_displacement_ = 0.0f;
+    std::size_t num_rebuilds_ = 0u;
+
+    /**
+     * Moves the pending sites towards their targets, then reverts the moved
+     * sites of every inverted triangle; sites that have not reached their
+     * targets stay pending.
+     */
+    void apply_pending_moves();
+};
+
+} // namespace pa093::algorithm::triangulation
@@ -0,0 +1,266 @@
+#include <pa093/algorithm/triangulation/point_location.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <utility>
+
+#include <glm/gtx/norm.hpp>
+
+#include <pa093/algorithm/geometric_functions.hpp>
+#include <pa093/algorithm/utility.hpp>
+#include <pa093/concurrency/parallel_for.hpp>
+#include <pa093/concurrency/parallel_sort.hpp>
+
+namespace pa093::algorithm::triangulation
+{
+
+namespace
+{
+
+[[nodiscard]] auto
+lexicographic(glm::vec2 const p) noexcept -> std::pair<float, float>
+{
+    return { p.x, p.y };
+}
+
+} // namespace
+
+void
+PointLocation::operator()(triangulation_type const& triangulation)
+{
+    reset();
+
+    auto const points = triangulation.points();
+    auto num_triangulated = 0u;
+
+    for (auto v = index_type{ 0 }; v < points.size(); ++v)
+    {
+        if (triangulation.vertex_halfedge(v) !=
+                triangulation_type::invalid_index and
+            num_triangulated++ % vertices_per_sample == 0u)
+        {
+            samples_.push_back(v);
+            sample_points_.push_back(points[v]);
+        }
+    }
+
+    build_tree_(sample_points_, sample_tree_);
+
+    // The tree only stores positions; map its leaves back to vertices
+    std::ranges::sort(samples_,
+                      std::less{},
+                      [&](index_type const v)
+                      { return lexicographic(points[v]); });
+    std::ranges::transform(
+        sample_tree_.points(),
+        std::back_inserter(leaf_samples_),
+        [&](point_type const p)
+        {
+            return *std::ranges::lower_bound(
+                samples_,
+                lexicographic(p),
+                std::less{},
+                [&](index_type const v) { return lexicographic(points[v]); });
+        });
+
+    // Beyond the typical sample spacing, jumping beats walking from the
+    // previous query
+    if (not samples_.empty())
+    {
+        auto min = points.front();
+        auto max = points.front();
+        for (auto const p : points)
+        {
+            min = glm::min(min, p);
+            max = glm::max(max, p);
+        }
+
+        auto const extent = max - min;
+        jump_distance2_ =
+            extent.x * extent.y / static_cast<float>(samples_.size());
+    }
+}
+
+auto
+PointLocation::locate(triangulation_type const& triangulation,
+                      point_type const query) const -> index_type
+{
+    auto const start = jump(triangulation, query);
+    if (start == triangulation_type::invalid_index)
+    {
+        return start;
+    }
+
+    return walk(triangulation, query, start);
+}
+
+void
+PointLocation::locate(triangulation_type const& triangulation,
+                      std::span<point_type const> const queries,
+                      std::span<index_type> const triangles)
+{
+    Expects(queries.size() == triangles.size());
+
+    if (queries.empty())
+    {
+        return;
+    }
+
+    // Sort the queries along a Morton curve over their bounding box
+    auto min = queries.front();
+    auto max = queries.front();
+    for (auto const q : queries)
+    {
+        min = glm::min(min, q);
+        max = glm::max(max, q);
+    }
+
+    constexpr auto max_cell =
+        static_cast<float>(std::numeric_limits<std::uint16_t>::max());
+    auto const scale =
+        max_cell /
+        glm::max(max - min, glm::vec2(std::numeric_limits<float>::min()));
+
+    query_keys_.resize(queries.size());
+    concurrency::parallel_for(
+        *jobs_,
+        queries.size(),
+        [&](std::size_t const i)
+        {
+            auto const cell = glm::clamp((queries[i] - min) * scale,
+                                         glm::vec2(0.0f),
+                                         glm::vec2(max_cell));
+            auto const code = morton_code(static_cast<std::uint16_t>(cell.x),
+                                          static_cast<std::uint16_t>(cell.y));
+
+            query_keys_[i] = (std::uint64_t{ code } << 32u) | i;
+        });
+    concurrency::parallel_sort(*jobs_, query_keys_);
+
+    concurrency::parallel_for_chunks(
+        *jobs_,
+        queries.size(),
+        [&](std::size_t, std::size_t const begin, std::size_t const end)
+        {
+            auto previous = triangulation_type::invalid_index;
+            auto previous_query = point_type{};
+
+            for (auto k = begin; k < end; ++k)
+            {
+                auto const i = static_cast<index_type>(query_keys_[k]);
+                auto const query = queries[i];
+
+                auto start = previous;
+                if (start == triangulation_type::invalid_index or
+                    glm::distance2(query, previous_query) > jump_distance2_)
+                {
+                    start = jump(triangulation, query);
+                }
+
+                auto const t = start == triangulation_type::invalid_index
+                                   ? start
+                                   : walk(triangulation, query, start);
+
+                triangles[i] = t;
+                if (t != triangulation_type::invalid_index)
+                {
+                    previous = t;
+                    previous_query = query;
+                }
+            }
+        });
+}
+
+void
+PointLocation::reset()
+{
+    build_tree_.reset();
+    sample_tree_.clear();
+    samples_.clear();
+    leaf_samples_.clear();
+    sample_points_.clear();
+    query_keys_.clear();
+    jump_distance2_ = 0.0f;
+}
+
+auto
+PointLocation::jump(triangulation_type const& triangulation,
+                    point_type const query) const -> index_type
+{
+    auto const leaf = nearest_sample_(sample_tree_, query);
+    if (not leaf)
+    {
+        return triangulation_type::invalid_index;
+    }
+
+    auto const v = leaf_samples_[datastructure::KDTree2f::leaf_index(leaf)];
+    return triangulation_type::triangle_of(triangulation.vertex_halfedge(v));
+}
+
+auto
+PointLocation::walk(triangulation_type const& triangulation,
+                    point_type const query,
+                    index_type t) -> index_type
+{
+    auto entry = triangulation_type::invalid_index;
+
+    // Visibility walks terminate on Delaunay triangulations; the step limit
+    // only guards against rounding on degenerate input
+    for (auto step = std::size_t{ 0 }; step < triangulation.num_triangles();
+         ++step)
+    {
+        auto next = triangulation_type::invalid_index;
+
+        for (auto k = 0u; k < 3u; ++k)
+        {
+            // Vary the first tested edge to avoid cycling on rounding
+            auto const e = 3u * t + static_cast<index_type>((k + step) % 3u);
+            if (e == entry)
+            {
+                continue;
+            }
+
+            auto const a = triangulation.point(triangulation.origin(e));
+            auto const b = triangulation.point(triangulation.target(e));
+            if (orientation(a, b, query) < 0.0)
+            {
+                next = e;
+                break;
+            }
+        }
+
+        if (next == triangulation_type::invalid_index)
+        {
+            return t;
+        }
+
+        entry = triangulation.twin(next);
+        if (entry == triangulation_type::invalid_index)
+        {
+            // Beyond a hull edge
+            return entry;
+        }
+        t = triangulation_type::triangle_of(entry);
+    }
+
+    // Fall back to testing every triangle
+    for (auto u = index_type{ 0 }; u < triangulation.num_triangles(); ++u)
+    {
+        auto const [i1, i2, i3] = triangulation.triangle(u);
+        auto const p1 = triangulation.point(i1);
+        auto const p2 = triangulation.point(i2);
+        auto const p3 = triangulation.point(i3);
+
+        if (orientation(p1, p2, query) >= 0.0 and
+            orientation(p2, p3, query) >= 0.0 and
+            orientation(p3, p1, query) >= 0.0)
+        {
+            return u;
+        }
+    }
+
+    return triangulation_type::invalid_index;
+}
+
+} // namespace pa093::algorithm::triangulation
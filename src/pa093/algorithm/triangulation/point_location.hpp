@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+#include <pa093/concurrency/job_system.hpp>
+#include <pa093/algorithm/kd_tree/build_kd_tree.hpp>
+#include <pa093/algorithm/kd_tree/nearest_neighbor.hpp>
+#include <pa093/datastructure/kd_tree.hpp>
+#include <pa093/datastructure/triangulation.hpp>
+
+namespace pa093::algorithm::triangulation
+{
+
+/**
+ * Locates the triangles containing query points by jump-and-walk.
+ *
+ * Building samples every few vertices of the triangulation into a k-D tree.
+ * A query jumps to the triangle of the nearest sample and walks towards the
+ * query point by orientation tests. Batches are presorted along a Morton
+ * curve, so that most walks continue from the previous query's triangle.
+ *
+ * Queries must be given the same triangulation the structure was built from.
+ */
+class PointLocation
+{
+public:
+    using triangulation_type = datastructure::Triangulation;
+    using index_type = triangulation_type::index_type;
+    using point_type = triangulation_type::point_type;
+
+    [[nodiscard]] explicit PointLocation(
+        std::pmr::memory_resource* const resource =
+            std::pmr::get_default_resource(),
+        concurrency::JobSystem& jobs =
+            concurrency::JobSystem::instance()) noexcept
+        : jobs_{ &jobs }
+        , build_tree_{ resource }
+        , sample_tree_{ resource }
+        , samples_{ resource }
+        , leaf_samples_{ resource }
+        , sample_points_{ resource }
+        , query_keys_{ resource }
+    {
+    }
+
+    void operator()(triangulation_type const& triangulation);
+
+    /**
+     * The triangle containing the point, or invalid_index outside of the
+     * triangulation. Points on an edge may be reported in either triangle.
+     */
+    [[nodiscard]] auto locate(triangulation_type const& triangulation,
+                              point_type query) const -> index_type;
+
+    /**
+     * Locates a batch of points in parallel; triangles[i] receives the
+     * triangle containing queries[i].
+     */
+    void locate(triangulation_type const& triangulation,
+                std::span<point_type const> queries,
+                std::span<index_type> triangles);
+
+    void reset();
+
+private:
+    /**
+     * Triangulated vertices per k-D tree sample
+     */
+    static constexpr auto vertices_per_sample = 16u;
+
+    concurrency::JobSystem* jobs_;
+    kd_tree::BuildKDTree2f build_tree_;
+    kd_tree::NearestNeighbor2f nearest_sample_;
+    datastructure::KDTree2f sample_tree_;
+    std::pmr::vector<index_type> samples_;
+    std::pmr::vector<index_type> leaf_samples_;
+    std::pmr::vector<point_type> sample_points_;
+    std::pmr::vector<std::uint64_t> query_keys_;
+    float jump_distance2_ = 0.0f;
+
+    [[nodiscard]] auto jump(triangulation_type const& triangulation,
+                            point_type query) const -> index_type;
+
+    [[nodiscard]] static auto walk(triangulation_type const& triangulation,
+                                   point_type query,
+                                   index_type start) -> index_type;
+};
+
+} // namespace pa093::algorithm::triangulation
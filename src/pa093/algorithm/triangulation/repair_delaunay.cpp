@@ -0,0 +1,135 @@
+#include <pa093/algorithm/triangulation/repair_delaunay.hpp>
+
+#include <cstddef>
+
+#include <pa093/algorithm/constants.hpp>
+#include <pa093/algorithm/geometric_functions.hpp>
+
+namespace pa093::algorithm::triangulation
+{
+
+auto
+RepairDelaunay::operator()(triangulation_type& triangulation) -> bool
+{
+    reset();
+
+    if (not is_valid(triangulation))
+    {
+        return false;
+    }
+
+    constexpr auto invalid_index = triangulation_type::invalid_index;
+    constexpr auto next_halfedge = &triangulation_type::next_halfedge;
+    constexpr auto prev_halfedge = &triangulation_type::prev_halfedge;
+
+    auto const points = triangulation.points();
+
+    // Check every internal edge once
+    for (auto e = index_type{ 0 }; e < triangulation.num_halfedges(); ++e)
+    {
+        if (auto const twin = triangulation.twin(e);
+            twin != invalid_index and e < twin)
+        {
+            edge_stack_.push_back(e);
+        }
+    }
+
+    auto flips_left =
+        std::size_t{ max_flips_per_halfedge } * triangulation.num_halfedges();
+
+    while (not edge_stack_.empty())
+    {
+        auto const a = edge_stack_.back();
+        edge_stack_.pop_back();
+
+        auto const b = triangulation.twin(a);
+        if (b == invalid_index)
+        {
+            continue;
+        }
+
+        auto const p0 = points[triangulation.origin(prev_halfedge(a))];
+        auto const pr = points[triangulation.origin(a)];
+        auto const pl = points[triangulation.origin(next_halfedge(a))];
+        auto const p1 = points[triangulation.origin(prev_halfedge(b))];
+
+        if (in_circle(p0, pr, pl, p1) <= 0.0 or
+            orientation(p0, p1, pl) <= 0.0 or orientation(p1, p0, pr) <= 0.0)
+        {
+            // Locally Delaunay, or the flip would produce an inverted
+            // triangle due to rounding
+            continue;
+        }
+
+        if (flips_left-- == 0u)
+        {
+            // Cycling on (nearly) cocircular points; the triangulation is
+            // valid, but not guaranteed to be Delaunay
+            return false;
+        }
+
+        triangulation.flip(a);
+
+        // The outer edges of the flipped quad may now be illegal
+        for (auto const e : { a, next_halfedge(a), b, next_halfedge(b) })
+        {
+            if (triangulation.twin(e) != invalid_index)
+            {
+                edge_stack_.push_back(e);
+            }
+        }
+    }
+
+    return true;
+}
+
+auto
+RepairDelaunay::is_valid(triangulation_type const& triangulation) noexcept
+    -> bool
+{
+    auto const points = triangulation.points();
+
+    for (auto t = index_type{ 0 }; t < triangulation.num_triangles(); ++t)
+    {
+        auto const [i1, i2, i3] = triangulation.triangle(t);
+        if (orientation(points[i1], points[i2], points[i3]) <= 0.0)
+        {
+            return false;
+        }
+    }
+
+    for (auto const [skipped, kept] : triangulation.duplicates())
+    {
+        if (not glm::all(glm::epsilonEqual(
+                points[skipped], points[kept], constants::epsilon_distance)))
+        {
+            // A skipped point separated from its twin and has to be inserted
+            return false;
+        }
+    }
+
+    if (triangulation.num_triangles() == 0u)
+    {
+        // Collinear input stays collinear only by chance
+        return triangulation.num_points() < 3u;
+    }
+
+    auto const hull = triangulation.hull();
+    for (auto i = std::size_t{ 0 }; i < hull.size(); ++i)
+    {
+        auto const prev = points[hull[(i + hull.size() - 1u) % hull.size()]];
+        auto const curr = points[hull[i]];
+        auto const next = points[hull[(i + 1u) % hull.size()]];
+
+        if (orientation(prev, curr, next) < 0.0)
+        {
+            // Reflex hull vertex; the triangulation no longer covers the
+            // convex hull
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace pa093::algorithm::triangulation
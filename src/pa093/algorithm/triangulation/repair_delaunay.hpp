@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory_resource>
+#include <vector>
+
+#include <pa093/datastructure/triangulation.hpp>
+
+namespace pa093::algorithm::triangulation
+{
+
+/**
+ * Restores the Delaunay property of a triangulation whose points have moved,
+ * using Lawson edge flips.
+ *
+ * Flips can only repair a triangulation that is still valid, i.e. with all
+ * triangles counter-clockwise and a convex hull boundary. If this is not the
+ * case, the triangulation is left unchanged and false is returned. If the
+ * flips fail to converge on degenerate input, false is returned as well,
+ * after some flips were applied: the triangulation is still valid, but not
+ * guaranteed to be Delaunay. Either way, the caller should re-triangulate.
+ */
+class RepairDelaunay
+{
+public:
+    using triangulation_type = datastructure::Triangulation;
+    using index_type = triangulation_type::index_type;
+
+    [[nodiscard]] explicit RepairDelaunay(
+        std::pmr::memory_resource* const resource =
+            std::pmr::get_default_resource()) noexcept
+        : edge_stack_{ resource }
+    {
+    }
+
+    auto operator()(triangulation_type& triangulation) -> bool;
+
+    void reset() { edge_stack_.clear(); }
+
+private:
+    /**
+     * Flips per half-edge after which the repair is considered divergent
+     */
+    static constexpr auto max_flips_per_halfedge = 8u;
+
+    std::pmr::vector<index_type> edge_stack_;
+
+    [[nodiscard]] static auto is_valid(
+        triangulation_type const& triangulation) noexcept -> bool;
+};
+
+} // namespace pa093::algorithm::triangulation
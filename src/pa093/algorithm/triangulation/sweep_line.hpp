@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <deque>
 #include <iterator>
+#include <memory_resource>
 #include <ranges>
 #include <vector>
 
@@ -15,6 +16,15 @@ namespace pa093::algorithm::triangulation
 class SweepLine
 {
 public:
+    [[nodiscard]] explicit SweepLine(
+        std::pmr::memory_resource* const resource =
+            std::pmr::get_default_resource()) noexcept
+        : top_path_{ resource }
+        , bottom_path_{ resource }
+        , stack_{ resource }
+    {
+    }
+
     template<std::ranges::forward_range R, std::output_iterator<glm::vec2> O>
     requires std::same_as<std::ranges::range_value_t<R>, glm::vec2>
     auto operator()(R&& range, O const result) -> O
@@ -195,9 +205,9 @@ private:
         bottom,
     };
 
-    std::deque<glm::vec2> top_path_;
-    std::deque<glm::vec2> bottom_path_;
-    std::vector<std::pair<glm::vec2, Path>> stack_;
+    std::pmr::deque<glm::vec2> top_path_;
+    std::pmr::deque<glm::vec2> bottom_path_;
+    std::pmr::vector<std::pair<glm::vec2, Path>> stack_;
 
     [[nodiscard]] auto paths_exhausted() const noexcept -> bool
     {
@@ -0,0 +1,278 @@
+#include <pa093/algorithm/triangulation/voronoi_cells.hpp>
+
+#include <algorithm>
+#include <iterator>
+
+#include <range/v3/view/enumerate.hpp>
+
+#include <pa093/algorithm/constants.hpp>
+#include <pa093/algorithm/geometric_functions.hpp>
+#include <pa093/concurrency/parallel_for.hpp>
+
+namespace pa093::algorithm::triangulation
+{
+
+namespace
+{
+
+/**
+ * Clips the convex polygon against the half-plane of points closer to site
+ * than to neighbour (Sutherland-Hodgman, single edge).
+ */
+void
+clip_to_bisector(std::pmr::vector<glm::vec2> const& polygon,
+                 glm::vec2 const site,
+                 glm::vec2 const neighbor,
+                 std::pmr::vector<glm::vec2>& result)
+{
+    result.clear();
+
+    auto const normal = neighbor - site;
+    auto const offset = glm::dot(normal, (site + neighbor) * 0.5f);
+    auto const signed_distance = [&](glm::vec2 const p)
+    { return glm::dot(normal, p) - offset; };
+
+    if (polygon.empty())
+    {
+        return;
+    }
+
+    auto prev = polygon.back();
+    auto prev_distance = signed_distance(prev);
+
+    for (auto const curr : polygon)
+    {
+        auto const curr_distance = signed_distance(curr);
+
+        if ((prev_distance <= 0.0f) != (curr_distance <= 0.0f))
+        {
+            // Edge crosses the bisector
+            auto const t = prev_distance / (prev_distance - curr_distance);
+            result.push_back(prev + t * (curr - prev));
+        }
+        if (curr_distance <= 0.0f)
+        {
+            result.push_back(curr);
+        }
+
+        prev = curr;
+        prev_distance = curr_distance;
+    }
+}
+
+[[nodiscard]] auto
+coincident(glm::vec2 const p1, glm::vec2 const p2) noexcept -> bool
+{
+    return glm::all(glm::epsilonEqual(p1, p2, constants::epsilon_distance));
+}
+
+} // namespace
+
+void
+VoronoiCells::operator()(triangulation_type const& triangulation,
+                         datastructure::PolygonSet& cells)
+{
+    reset();
+
+    auto const num_sites = triangulation.num_points();
+
+    // Dual vertices
+    circumcenters_.resize(triangulation.num_triangles());
+    concurrency::parallel_for(
+        *jobs_,
+        circumcenters_.size(),
+        [&](std::size_t const t)
+        {
+            auto const [i1, i2, i3] =
+                triangulation.triangle(static_cast<index_type>(t));
+            circumcenters_[t] = circumcircle_center(triangulation.point(i1),
+                                                    triangulation.point(i2),
+                                                    triangulation.point(i3));
+        });
+
+    // Build the cells of each contiguous chunk of sites into a chunk-local
+    // buffer, then copy the buffers into place once the offsets are known.
+    cell_sizes_.resize(num_sites);
+    chunk_begins_.resize(concurrency::max_chunk_count(*jobs_));
+    chunk_vertices_.resize(concurrency::max_chunk_count(*jobs_));
+    chunk_cells_.resize(concurrency::max_chunk_count(*jobs_));
+    chunk_scratch_.resize(concurrency::max_chunk_count(*jobs_));
+
+    if (triangulation.num_triangles() == 0u)
+    {
+        // Collinear sites; neighbours are adjacent along the hull
+        hull_positions_.assign(num_sites, triangulation_type::invalid_index);
+        for (auto const [position, site] :
+             ranges::views::enumerate(triangulation.hull()))
+        {
+            hull_positions_[site] = static_cast<index_type>(position);
+        }
+    }
+
+    auto const num_chunks = concurrency::parallel_for_chunks(
+        *jobs_,
+        num_sites,
+        [&](std::size_t const chunk,
+            std::size_t const begin,
+            std::size_t const end)
+        {
+            auto& vertices = chunk_vertices_[chunk];
+            vertices.clear();
+            chunk_begins_[chunk] = begin;
+
+            auto& cell = chunk_cells_[chunk];
+            auto& scratch = chunk_scratch_[chunk];
+
+            for (auto site = begin; site < end; ++site)
+            {
+                auto const cell_start = vertices.size();
+                auto const i = static_cast<index_type>(site);
+
+                if (not append_interior_cell(triangulation, i, vertices))
+                {
+                    vertices.resize(cell_start);
+                    clip_cell(triangulation, i, cell, scratch);
+                    vertices.insert(vertices.end(), cell.begin(), cell.end());
+                }
+
+                cell_sizes_[site] = vertices.size() - cell_start;
+            }
+        });
+
+    cells.set_layout(cell_sizes_);
+
+    concurrency::parallel_for(
+        *jobs_,
+        num_chunks,
+        [&](std::size_t const chunk)
+        {
+            auto const& vertices = chunk_vertices_[chunk];
+            auto const offset = cells.offsets()[chunk_begins_[chunk]];
+
+            std::ranges::copy(vertices,
+                              std::next(cells.vertices().begin(),
+                                        static_cast<std::ptrdiff_t>(offset)));
+        },
+        1u);
+}
+
+void
+VoronoiCells::reset()
+{
+    circumcenters_.clear();
+    hull_positions_.clear();
+    cell_sizes_.clear();
+}
+
+auto
+VoronoiCells::append_interior_cell(triangulation_type const& triangulation,
+                                   index_type const site,
+                                   std::pmr::vector<glm::vec2>& vertices) const
+    -> bool
+{
+    auto const start = triangulation.vertex_halfedge(site);
+    if (start == triangulation_type::invalid_index or
+        triangulation.is_hull_edge(start))
+    {
+        // Unbounded cell
+        return false;
+    }
+
+    auto const cell_start = vertices.size();
+    auto inside = true;
+
+    triangulation.for_each_outgoing(
+        site,
+        [&](index_type const e)
+        {
+            auto const& s =
+                circumcenters_[triangulation_type::triangle_of(e)];
+
+            if (not inside or not s or
+                glm::any(glm::lessThan(*s, bounds_min_)) or
+                glm::any(glm::greaterThan(*s, bounds_max_)))
+            {
+                inside = false;
+                return;
+            }
+
+            if (vertices.size() == cell_start or
+                not coincident(vertices.back(), *s))
+            {
+                vertices.push_back(*s);
+            }
+        });
+
+    if (not inside)
+    {
+        return false;
+    }
+
+    if (vertices.size() - cell_start > 1u and
+        coincident(vertices.back(), vertices[cell_start]))
+    {
+        vertices.pop_back();
+    }
+
+    return true;
+}
+
+void
+VoronoiCells::clip_cell(triangulation_type const& triangulation,
+                        index_type const site,
+                        std::pmr::vector<glm::vec2>& cell,
+                        std::pmr::vector<glm::vec2>& scratch) const
+{
+    cell.assign({
+        bounds_min_,
+        { bounds_max_.x, bounds_min_.y },
+        bounds_max_,
+        { bounds_min_.x, bounds_max_.y },
+    });
+
+    auto const p = triangulation.point(site);
+    auto const clip = [&](index_type const neighbor)
+    {
+        clip_to_bisector(cell, p, triangulation.point(neighbor), scratch);
+        std::swap(cell, scratch);
+    };
+
+    if (triangulation.vertex_halfedge(site) !=
+        triangulation_type::invalid_index)
+    {
+        auto const last = triangulation.for_each_outgoing(
+            site,
+            [&](index_type const e) { clip(triangulation.target(e)); });
+
+        // Around a hull point, the last neighbour is only reachable as the
+        // origin of the incoming hull edge
+        auto const incoming = triangulation_type::prev_halfedge(last);
+        if (triangulation.is_hull_edge(incoming))
+        {
+            clip(triangulation.origin(incoming));
+        }
+        return;
+    }
+
+    // Points without triangles: either skipped duplicates, or collinear input
+    // ordered along the hull
+    if (hull_positions_.empty() or
+        hull_positions_[site] == triangulation_type::invalid_index)
+    {
+        cell.clear();
+        return;
+    }
+
+    auto const hull = triangulation.hull();
+    auto const position = hull_positions_[site];
+    if (position > 0u)
+    {
+        clip(hull[position - 1u]);
+    }
+    if (position + 1u < hull.size())
+    {
+        clip(hull[position + 1u]);
+    }
+}
+
+} // namespace pa093::algorithm::triangulation
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <optional>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <pa093/concurrency/job_system.hpp>
+#include <pa093/datastructure/polygon_set.hpp>
+#include <pa093/datastructure/triangulation.hpp>
+
+namespace pa093::algorithm::triangulation
+{
+
+/**
+ * Computes the Voronoi cell of every site of a Delaunay triangulation as a
+ * counter-clockwise polygon clipped to an axis-aligned rectangle.
+ *
+ * Cells of interior sites that lie fully inside the rectangle are read off
+ * the circumcenters of the incident triangles; all other cells are built by
+ * clipping the rectangle with the bisectors of the Delaunay neighbours.
+ * Sites missing from the triangulation get empty cells.
+ */
+class VoronoiCells
+{
+public:
+    using triangulation_type = datastructure::Triangulation;
+    using index_type = triangulation_type::index_type;
+
+    [[nodiscard]] VoronoiCells(glm::vec2 const bounds_min,
+                               glm::vec2 const bounds_max,
+                               std::pmr::memory_resource* const resource =
+                                   std::pmr::get_default_resource(),
+                               concurrency::JobSystem& jobs =
+                                   concurrency::JobSystem::instance()) noexcept
+        : bounds_min_{ bounds_min }
+        , bounds_max_{ bounds_max }
+        , jobs_{ &jobs }
+        , circumcenters_{ resource }
+        , hull_positions_{ resource }
+        , cell_sizes_{ resource }
+        , chunk_begins_{ resource }
+        , chunk_vertices_{ resource }
+        , chunk_cells_{ resource }
+        , chunk_scratch_{ resource }
+    {
+    }
+
+    void operator()(triangulation_type const& triangulation,
+                    datastructure::PolygonSet& cells);
+
+    void reset();
+
+private:
+    glm::vec2 bounds_min_;
+    glm::vec2 bounds_max_;
+    concurrency::JobSystem* jobs_;
+    std::pmr::vector<std::optional<glm::vec2>> circumcenters_;
+    std::pmr::vector<index_type> hull_positions_;
+    std::pmr::vector<std::size_t> cell_sizes_;
+    std::pmr::vector<std::size_t> chunk_begins_;
+    std::pmr::vector<std::pmr::vector<glm::vec2>> chunk_vertices_;
+    std::pmr::vector<std::pmr::vector<glm::vec2>> chunk_cells_;
+    std::pmr::vector<std::pmr::vector<glm::vec2>> chunk_scratch_;
+
+    /**
+     * Appends the cell of an interior site if all of its vertices lie inside
+     * the bounds; returns false (leaving garbage appended) otherwise.
+     */
+    auto append_interior_cell(triangulation_type const& triangulation,
+                              index_type site,
+                              std::pmr::vector<glm::vec2>& vertices) const
+        -> bool;
+
+    void clip_cell(triangulation_type const& triangulation,
+                   index_type site,
+                   std::pmr::vector<glm::vec2>& cell,
+                   std::pmr::vector<glm::vec2>& scratch) const;
+};
+
+} // namespace pa093::algorithm::triangulation
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <iterator>
 
 namespace pa093::algorithm
@@ -20,4 +21,23 @@ swap_back_and_pop(Sequence& sequence, typename Sequence::iterator pos) ->
     return elem;
 }
 
+/**
+ * Interleaves the bits of x and y into a Morton (Z-order) code
+ */
+[[nodiscard]] constexpr auto
+morton_code(std::uint16_t const x, std::uint16_t const y) noexcept
+    -> std::uint32_t
+{
+    auto const spread = [](std::uint32_t v)
+    {
+        v = (v | (v << 8u)) & 0x00ff00ffu;
+        v = (v | (v << 4u)) & 0x0f0f0f0fu;
+        v = (v | (v << 2u)) & 0x33333333u;
+        v = (v | (v << 1u)) & 0x55555555u;
+        return v;
+    };
+
+    return spread(x) | (spread(y) << 1u);
+}
+
 } // namespace pa093::algorithm
@@ -1,17 +1,27 @@
 #include <pa093/app.hpp>
 
+#include <iterator>
+#include <span>
+#include <string>
+
+#include <GLFW/glfw3.h>
+#include <fmt/format.h>
 #include <glm/gtx/norm.hpp>
 #include <spdlog/spdlog.h>
 
-#include "pa093/algorithm/convex_hull/gift_wrapping.hpp"
+#include <pa093/algorithm/batch.hpp>
+#include <pa093/concurrency/job_system.hpp>
+#include <pa093/profiling/profiler.hpp>
 
 namespace pa093
 {
 
 App::App(glpp::glfw::Window& window)
+    // Wakes the frame loop waiting for events
+    : scene_worker_{ [] { glfwPostEmptyEvent(); } }
 {
     auto rd = std::random_device{};
-    rng_.seed(rd());
+    editor_.seed(rd());
 
     auto const [hor_scale, vert_scale] = window.content_scale();
     set_content_scale({ hor_scale, vert_scale });
@@ -37,6 +47,10 @@ App::App(glpp::glfw::Window& window)
                 static_cast<float>(event.width),
                 static_cast<float>(event.height),
             };
+
+            // The level of detail depends on the framebuffer resolution
+            uploaded_versions_.point_lod = 0u;
+            uploaded_versions_.kd_tree = 0u;
         }));
 
     event_connections_.emplace_back(window.on_mouse_button(
@@ -57,7 +71,7 @@ App::App(glpp::glfw::Window& window)
                     }
                     else
                     {
-                        add_point(cursor_pos_);
+                        editor_.add_point(cursor_pos_);
                     }
                 }
                 else if (event.action == glpp::glfw::KeyAction::release)
@@ -71,7 +85,7 @@ App::App(glpp::glfw::Window& window)
                 {
                     if (highlighted_point_)
                     {
-                        remove_point(*highlighted_point_);
+                        editor_.remove_point(*highlighted_point_);
                         highlighted_point_.reset();
                         dragged_point_.reset();
                     }
@@ -83,12 +97,17 @@ App::App(glpp::glfw::Window& window)
 void
 App::update()
 {
+    PA093_PROFILE_SCOPE("Update");
+
+    frame_arena_.reset();
+    PA093_PROFILE_COUNTER("Frame arena upstream allocations",
+                          frame_arena_.upstream_allocations());
+
     if (dragged_point_)
     {
         // Update dragged point
-        points_[*dragged_point_] = cursor_pos_;
+        editor_.move_point(*dragged_point_, cursor_pos_);
         highlighted_point_ = *dragged_point_;
-        scene_dirty_ = true;
     }
     else if (gui_hovered_)
     {
@@ -102,77 +121,87 @@ App::update()
         highlighted_point_ = new_highlighted_point;
     }
 
-    // Show / hide highlighted point
-    if (highlighted_point_)
+    // Show / hide highlighted point, uploading only when it changed
+    auto const highlight =
+        highlighted_point_
+            ? std::optional{ editor_.points()[*highlighted_point_] }
+            : std::nullopt;
+    if (std::exchange(uploaded_highlight_, highlight) != highlight)
     {
         highlighted_point_mesh_.set_vertex_positions(
-            std::span{ &points_[*highlighted_point_], 1u });
+            highlight ? std::span{ &*highlight, 1u }
+                      : std::span<glm::vec2 const>{});
     }
-    else
+
+    // Relaxed points replace the points before the frame is closed, so that
+    // the new points are submitted right away
+    auto const geometry_completed = scene_worker_.poll();
+    if (geometry_completed)
     {
-        highlighted_point_mesh_.set_vertex_positions({});
+        editor_.finish_relaxation(scene_worker_.geometry().relaxed_points);
     }
 
-    if (std::exchange(scene_dirty_, false))
+    if (editor_.end_frame())
     {
-        // Update scene geometry
-        polygon_points_.clear();
-        triangle_points_.clear();
-        voronoi_points_.clear();
-        kd_tree_.clear();
-
-        switch (polygon_mode_)
+        if (auto const version = editor_.points_version();
+            version != uploaded_versions_.points)
         {
-            case PolygonMode::none:
-                break;
-            case PolygonMode::all_points:
-                polygon_points_ = points_;
-                break;
-            case PolygonMode::gift_wrapping_convex_hull:
-                gift_wrapping_(points_, std::back_inserter(polygon_points_));
-                break;
-            case PolygonMode::graham_scan_convex_hull:
-                graham_scan_(points_, std::back_inserter(polygon_points_));
-                break;
+            PA093_PROFILE_COUNTER("Points", editor_.points().size());
+
+            // The changed range is relative to the previous version only
+            auto const changed =
+                version == uploaded_versions_.points + 1u
+                    ? editor_.changed_points()
+                    : scene::PointRange{ 0u, editor_.points().size() };
+            point_mesh_.update_vertex_positions(
+                editor_.points(), changed.begin, changed.end);
+            uploaded_versions_.points = version;
         }
 
-        switch (triangulation_mode_)
+        submit_scene();
+    }
+
+    draw_point_lod_ = editor_.points().size() > max_full_detail_points;
+    if (not draw_point_lod_)
+    {
+        uploaded_versions_.point_lod = 0u;
+    }
+    else if (auto const version = editor_.points_version();
+             version != uploaded_versions_.point_lod)
+    {
+        // Rebuilt from scratch when the level of detail was not kept up to
+        // date, otherwise updated with the changed points only
+        if (uploaded_versions_.point_lod != 0u and
+            version == uploaded_versions_.point_lod + 1u)
         {
-            case TriangulationMode::none:
-                break;
-            case TriangulationMode::sweep_line:
-                sweep_line_(polygon_points_,
-                            std::back_inserter(triangle_points_));
-                break;
-            case TriangulationMode::delaunay:
-                delaunay_(points_, std::back_inserter(triangle_points_));
-                break;
-            case TriangulationMode::delaunay_plus_voronoi:
-                delaunay_(points_, std::back_inserter(triangle_points_));
-                voronoi_(triangle_points_, std::back_inserter(voronoi_points_));
-                break;
+            auto const changed = editor_.changed_points();
+            point_lod_.update_points(editor_.points(),
+                                     framebuffer_size_,
+                                     changed.begin,
+                                     changed.end);
         }
-
-        switch (partitioning_mode_)
+        else
         {
-            case PartitioningMode::none:
-                break;
-            case PartitioningMode::kd_tree:
-                build_kd_tree_(points_, kd_tree_);
-                break;
+            point_lod_.set_points(editor_.points(), framebuffer_size_);
         }
+        uploaded_versions_.point_lod = version;
+    }
 
-        point_mesh_.set_vertex_positions(points_);
-        polygon_mesh_.set_vertex_positions(polygon_points_);
-        triangle_mesh_.set_vertex_positions(triangle_points_);
-        voronoi_mesh_.set_vertex_positions(voronoi_points_);
-        kd_tree_visualization_.set_tree(kd_tree_);
+    // Also reshows the k-D tree after a framebuffer resize
+    if (geometry_completed or uploaded_versions_.kd_tree !=
+                                  scene_worker_.geometry().kd_tree_version)
+    {
+        show_scene_geometry(scene_worker_.geometry());
     }
 }
 
 void
 App::draw_gui()
 {
+    PA093_PROFILE_SCOPE("GUI");
+
+    draw_profiler();
+
     if (not ImGui::Begin("Tools", nullptr, ImGuiWindowFlags_AlwaysAutoResize))
     {
         ImGui::End();
@@ -181,11 +210,18 @@ App::draw_gui()
 
     ImGui::Dummy({ min_toolbar_width_pixels, 0 });
 
+    auto const& geometry = scene_worker_.geometry();
+    if (scene_worker_.busy())
+    {
+        ImGui::Text("Computing...");
+    }
+
     if (ImGui::CollapsingHeader("Polygon", ImGuiTreeNodeFlags_DefaultOpen))
     {
         ImGui::PushID("polygon");
 
-        auto mode_value = static_cast<int>(polygon_mode_);
+        auto mode_value =
+            static_cast<int>(editor_.settings().polygon_mode);
         ImGui::RadioButton(
             "None", &mode_value, static_cast<int>(PolygonMode::none));
         ImGui::RadioButton("All points",
@@ -199,7 +235,7 @@ App::draw_gui()
             "Convex hull (Graham's scan)",
             &mode_value,
             static_cast<int>(PolygonMode::graham_scan_convex_hull));
-        set_polygon_mode(static_cast<PolygonMode>(mode_value));
+        editor_.set_polygon_mode(static_cast<PolygonMode>(mode_value));
 
         ImGui::Spacing();
         ImGui::Separator();
@@ -209,9 +245,9 @@ App::draw_gui()
                     PolygonMode::gift_wrapping_convex_hull,
                     PolygonMode::graham_scan_convex_hull,
                 },
-                polygon_mode_))
+                editor_.settings().polygon_mode))
         {
-            ImGui::Text("%zu hull points", polygon_points_.size());
+            ImGui::Text("%zu hull points", geometry.polygon.indices.size());
         }
 
         ImGui::Spacing();
@@ -224,7 +260,8 @@ App::draw_gui()
     {
         ImGui::PushID("triangulation");
 
-        auto mode_value = static_cast<int>(triangulation_mode_);
+        auto mode_value =
+            static_cast<int>(editor_.settings().triangulation_mode);
         ImGui::RadioButton(
             "None", &mode_value, static_cast<int>(TriangulationMode::none));
         ImGui::RadioButton("Sweep line (triangulates current polygon)",
@@ -237,11 +274,61 @@ App::draw_gui()
             "Delaunay + Voronoi diagram",
             &mode_value,
             static_cast<int>(TriangulationMode::delaunay_plus_voronoi));
-        set_triangulation_mode(static_cast<TriangulationMode>(mode_value));
+        ImGui::RadioButton(
+            "Delaunay + Voronoi cells (clipped to view)",
+            &mode_value,
+            static_cast<int>(TriangulationMode::delaunay_plus_voronoi_cells));
+        ImGui::RadioButton("Alpha shape",
+                           &mode_value,
+                           static_cast<int>(TriangulationMode::alpha_shape));
+        editor_.set_triangulation_mode(
+            static_cast<TriangulationMode>(mode_value));
+
+        ImGui::Spacing();
+        ImGui::Separator();
+
+        if (editor_.settings().triangulation_mode ==
+            TriangulationMode::alpha_shape)
+        {
+            auto alpha = editor_.settings().alpha;
+            ImGui::SliderFloat("Alpha", &alpha, 0.0f, max_alpha);
+            editor_.set_alpha(alpha);
+
+            ImGui::Text("%zu triangles, %zu boundary edges",
+                        geometry.num_alpha_shape_triangles,
+                        geometry.num_alpha_shape_boundary_edges);
+        }
+
+        ImGui::Spacing();
+
+        ImGui::PopID();
+    }
+
+    if (ImGui::CollapsingHeader("Graph", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        ImGui::PushID("graph");
+
+        auto mode_value = static_cast<int>(editor_.settings().graph_mode);
+        ImGui::RadioButton(
+            "None", &mode_value, static_cast<int>(GraphMode::none));
+        ImGui::RadioButton("Euclidean minimum spanning tree",
+                           &mode_value,
+                           static_cast<int>(GraphMode::euclidean_mst));
+        ImGui::RadioButton("Closest pair",
+                           &mode_value,
+                           static_cast<int>(GraphMode::closest_pair));
+        editor_.set_graph_mode(static_cast<GraphMode>(mode_value));
 
         ImGui::Spacing();
         ImGui::Separator();
 
+        if (editor_.settings().graph_mode != GraphMode::none)
+        {
+            ImGui::Text("%zu edges, length %f",
+                        geometry.num_graph_edges,
+                        geometry.graph_length);
+        }
+
         ImGui::Spacing();
 
         ImGui::PopID();
@@ -251,13 +338,15 @@ App::draw_gui()
     {
         ImGui::PushID("partitioning");
 
-        auto mode_value = static_cast<int>(partitioning_mode_);
+        auto mode_value =
+            static_cast<int>(editor_.settings().partitioning_mode);
         ImGui::RadioButton(
             "None", &mode_value, static_cast<int>(PartitioningMode::none));
         ImGui::RadioButton("k-D tree",
                            &mode_value,
                            static_cast<int>(PartitioningMode::kd_tree));
-        set_partitioning_mode(static_cast<PartitioningMode>(mode_value));
+        editor_.set_partitioning_mode(
+            static_cast<PartitioningMode>(mode_value));
 
         ImGui::Spacing();
         ImGui::Separator();
@@ -271,17 +360,30 @@ App::draw_gui()
     {
         if (ImGui::Button("Generate"))
         {
-            generate_random_points(
-                static_cast<std::size_t>(num_points_to_generate_));
+            editor_.generate_random_points(
+                static_cast<std::size_t>(num_points_to_generate_),
+                point_distribution_);
         }
         ImGui::SameLine();
-        ImGui::SliderInt("", &num_points_to_generate_, 1, max_generated_points);
+        ImGui::InputInt("##count", &num_points_to_generate_, 1'000, 100'000);
         num_points_to_generate_ =
             std::clamp(num_points_to_generate_, 1, max_generated_points);
 
+        show_point_distribution_settings();
+
         if (ImGui::Button("Clear"))
         {
-            remove_all_points();
+            editor_.remove_all_points();
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Relax (Lloyd)"))
+        {
+            editor_.request_relaxation();
+        }
+        if (editor_.relaxation_pending())
+        {
+            ImGui::SameLine();
+            ImGui::Text("Relaxing...");
         }
 
         ImGui::Spacing();
@@ -295,8 +397,8 @@ App::draw_gui()
         if (highlighted_point_)
         {
             ImGui::Text("%f, %f (%zu)",
-                        points_[*highlighted_point_].x,
-                        points_[*highlighted_point_].y,
+                        editor_.points()[*highlighted_point_].x,
+                        editor_.points()[*highlighted_point_].y,
                         *highlighted_point_);
         }
         else
@@ -304,7 +406,54 @@ App::draw_gui()
             ImGui::Text("%f, %f", cursor_pos_.x, cursor_pos_.y);
         }
 
-        ImGui::Text("%zu points", points_.size());
+        ImGui::Text("%zu points", editor_.points().size());
+
+        ImGui::Spacing();
+    }
+
+    if (ImGui::CollapsingHeader("Performance"))
+    {
+        auto& jobs = concurrency::JobSystem::instance();
+
+        auto thread_count = static_cast<int>(jobs.thread_count());
+        if (ImGui::SliderInt("Threads",
+                             &thread_count,
+                             1,
+                             static_cast<int>(jobs.max_thread_count())))
+        {
+            jobs.set_thread_count(static_cast<std::size_t>(thread_count));
+        }
+
+        ImGui::Checkbox("Redraw continuously", &redraw_continuously_);
+
+        if (draw_point_lod_)
+        {
+            ImGui::Text("Drawing %zu of %zu points",
+                        point_lod_.num_representatives(),
+                        editor_.points().size());
+        }
+
+        ImGui::Spacing();
+    }
+
+    if (ImGui::CollapsingHeader("Session"))
+    {
+        if (not editor_.recording())
+        {
+            if (ImGui::Button("Start recording"))
+            {
+                editor_.start_recording(session_file_name);
+            }
+        }
+        else
+        {
+            if (ImGui::Button("Stop recording"))
+            {
+                editor_.stop_recording();
+            }
+            ImGui::SameLine();
+            ImGui::Text("Recording to %s", session_file_name);
+        }
 
         ImGui::Spacing();
     }
@@ -317,114 +466,148 @@ App::draw_gui()
 void
 App::draw_scene()
 {
-    if (triangulation_mode_ != TriangulationMode::none)
-    {
-        glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-        triangle_mesh_.draw(glpp::DrawPrimitive::triangles, triangle_color);
-        glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
-    }
+    PA093_PROFILE_SCOPE("Draw scene");
 
-    if (triangulation_mode_ == TriangulationMode::delaunay_plus_voronoi)
-    {
-        voronoi_mesh_.draw(glpp::DrawPrimitive::lines, voronoi_color);
-    }
+    // Draw what the last completed geometry was computed for
+    auto const& settings = scene_worker_.geometry().settings;
+
+    // Layers disabled in the settings are empty and not drawn
+    scene_renderer_.draw();
 
-    if (partitioning_mode_ == PartitioningMode::kd_tree)
+    if (settings.partitioning_mode == PartitioningMode::kd_tree)
     {
         kd_tree_visualization_.draw(kd_tree_horizontal_color,
                                     kd_tree_vertical_color);
     }
 
-    point_mesh_.draw_points(5.0f, default_color);
-
-    if (polygon_mode_ != PolygonMode::none)
+    if (draw_point_lod_)
     {
-        polygon_mesh_.draw(glpp::DrawPrimitive::line_loop, polygon_color);
-        polygon_mesh_.draw_points(10.0f, polygon_color);
+        point_lod_.draw_points(5.0f, default_color);
+    }
+    else
+    {
+        point_mesh_.draw_points(5.0f, default_color);
     }
 
+    scene_renderer_.draw_polygon(10.0f);
+
     highlighted_point_mesh_.draw_points(10.0f, highlighted_color);
 }
 
 void
-App::set_content_scale(glm::vec2 const scale)
+App::draw_profiler()
 {
-    ImGui::GetIO().Fonts->ClearFonts();
+#ifdef PA093_PROFILING
+    auto& profiler = profiling::Profiler::instance();
+    auto* const resource = frame_arena_.resource();
 
-    auto cfg = ImFontConfig{};
-    cfg.SizePixels = font_size_pixels_unscaled * std::max(scale.x, scale.y);
-    ImGui::GetIO().Fonts->AddFontDefault(&cfg);
-}
-
-void
-App::set_polygon_mode(PolygonMode const mode)
-{
-    if (std::exchange(polygon_mode_, mode) != mode)
+    if (not ImGui::Begin(
+            "Profiler", nullptr, ImGuiWindowFlags_AlwaysAutoResize))
     {
-        scene_dirty_ = true;
+        ImGui::End();
+        return;
     }
-}
 
-void
-App::set_triangulation_mode(TriangulationMode const mode)
-{
-    if (std::exchange(triangulation_mode_, mode) != mode)
+    ImGui::Text("%llu allocations last frame",
+                static_cast<unsigned long long>(profiler.frame_allocations()));
+    for (auto const& counter : profiler.counters(resource))
     {
-        scene_dirty_ = true;
+        ImGui::Text("%.*s: %.0f",
+                    static_cast<int>(counter.name.size()),
+                    counter.name.data(),
+                    counter.value);
     }
-}
 
-void
-App::set_partitioning_mode(PartitioningMode const mode)
-{
-    if (std::exchange(partitioning_mode_, mode) != mode)
+    ImGui::Spacing();
+    ImGui::Separator();
+
+    // Rolling per-frame time of every stage, worker thread stages included
+    auto overlay = std::pmr::string{ resource };
+    for (auto const& stage : profiler.stages(resource))
     {
-        scene_dirty_ = true;
+        overlay.clear();
+        fmt::format_to(std::back_inserter(overlay),
+                       "{} {:.2f} ms (mean {:.2f}, max {:.2f})",
+                       stage.name,
+                       stage.last_ms,
+                       stage.mean_ms,
+                       stage.max_ms);
+
+        ImGui::PushID(stage.name.data(), stage.name.data() + stage.name.size());
+        ImGui::PlotLines("",
+                         stage.history_ms.data(),
+                         static_cast<int>(stage.history_ms.size()),
+                         0,
+                         overlay.c_str(),
+                         0.0f,
+                         std::max(stage.max_ms, min_profiler_plot_ms),
+                         { profiler_plot_width_pixels, 0.0f });
+        ImGui::PopID();
     }
-}
 
-void
-App::add_point(glm::vec2 const pos)
-{
-    spdlog::info("Adding point at {0}, {1}", pos.x, pos.y);
+    ImGui::Spacing();
+    ImGui::Separator();
+
+    if (not profiler.tracing())
+    {
+        if (ImGui::Button("Start trace"))
+        {
+            profiler.start_trace();
+        }
+    }
+    else if (ImGui::Button("Stop and save trace"))
+    {
+        try
+        {
+            auto const num_events = profiler.stop_trace(trace_file_name);
+            spdlog::info(
+                "Wrote {0} trace events to {1}", num_events, trace_file_name);
+        }
+        catch (std::exception const& error)
+        {
+            spdlog::error("Failed to save trace: {0}", error.what());
+        }
+    }
 
-    points_.push_back(pos);
-    scene_dirty_ = true;
+    ImGui::End();
+#endif
 }
 
 void
-App::remove_point(std::size_t const point_index)
+App::set_content_scale(glm::vec2 const scale)
 {
-    auto const point_iter =
-        points_.begin() + static_cast<std::ptrdiff_t>(point_index);
-    spdlog::info("Removing point at {0}, {1}", point_iter->x, point_iter->y);
+    ImGui::GetIO().Fonts->ClearFonts();
 
-    points_.erase(point_iter);
-    scene_dirty_ = true;
+    auto cfg = ImFontConfig{};
+    cfg.SizePixels = font_size_pixels_unscaled * std::max(scale.x, scale.y);
+    ImGui::GetIO().Fonts->AddFontDefault(&cfg);
 }
 
 void
-App::remove_all_points()
+App::submit_scene()
 {
-    spdlog::info("Removing all points");
+    auto& input = scene_worker_.input();
+    input.generation = ++scene_generation_;
+    editor_.get_input(input);
 
-    points_.clear();
-    scene_dirty_ = true;
+    scene_worker_.submit();
 }
 
 void
-App::generate_random_points(std::size_t const count)
+App::show_scene_geometry(scene::SceneGeometry const& geometry)
 {
-    spdlog::info("Generating {0} points", count);
+    PA093_PROFILE_SCOPE("Show scene");
+    PA093_PROFILE_COUNTER("Triangles", geometry.triangles.indices.size() / 3u);
+    PA093_PROFILE_COUNTER("Graph edges", geometry.num_graph_edges);
 
-    auto coord_dist = std::uniform_real_distribution{ -1.0f, 1.0f };
+    // Skips uploads of layers the pipeline did not recompute
+    scene_renderer_.set_geometry(geometry);
 
-    std::generate_n(std::back_inserter(points_),
-                    count,
-                    [&] {
-                        return glm::vec2{ coord_dist(rng_), coord_dist(rng_) };
-                    });
-    scene_dirty_ = true;
+    if (std::exchange(uploaded_versions_.kd_tree, geometry.kd_tree_version) !=
+        geometry.kd_tree_version)
+    {
+        kd_tree_visualization_.set_tree(geometry.kd_tree, framebuffer_size_);
+    }
 }
 
 auto
@@ -436,20 +619,78 @@ App::point_from_screen_coords(glm::vec2 screen_coords) const -> glm::vec2
     };
 }
 
+void
+App::show_point_distribution_settings()
+{
+    using generator::Distribution;
+
+    ImGui::PushID("distribution");
+
+    auto& d = point_distribution_;
+    auto distribution_value = static_cast<int>(d.distribution);
+    ImGui::RadioButton("Uniform",
+                       &distribution_value,
+                       static_cast<int>(Distribution::uniform));
+    ImGui::RadioButton("Gaussian clusters",
+                       &distribution_value,
+                       static_cast<int>(Distribution::gaussian_clusters));
+    ImGui::RadioButton("Annulus",
+                       &distribution_value,
+                       static_cast<int>(Distribution::annulus));
+    ImGui::RadioButton(
+        "Grid", &distribution_value, static_cast<int>(Distribution::grid));
+    d.distribution = static_cast<Distribution>(distribution_value);
+
+    switch (d.distribution)
+    {
+        case Distribution::uniform:
+            break;
+        case Distribution::gaussian_clusters:
+        {
+            auto num_clusters = static_cast<int>(d.num_clusters);
+            ImGui::SliderInt("Clusters", &num_clusters, 1, max_clusters);
+            d.num_clusters =
+                static_cast<std::uint32_t>(std::max(num_clusters, 1));
+            ImGui::SliderFloat("Sigma", &d.cluster_sigma, 0.0f, 0.5f);
+            break;
+        }
+        case Distribution::annulus:
+            ImGui::SliderFloat("Inner radius", &d.inner_radius, 0.0f, 1.0f);
+            ImGui::SliderFloat("Outer radius", &d.outer_radius, 0.0f, 1.0f);
+            break;
+        case Distribution::grid:
+        {
+            auto grid_size = static_cast<int>(d.grid_size);
+            ImGui::SliderInt("Grid size", &grid_size, 2, max_grid_size);
+            d.grid_size = static_cast<std::uint32_t>(std::max(grid_size, 2));
+            ImGui::SliderFloat("Jitter", &d.grid_jitter, 0.0f, 1.0f);
+            break;
+        }
+    }
+
+    // Sliders can be typed into beyond their range
+    d.cluster_sigma = std::clamp(d.cluster_sigma, 0.0f, 1.0f);
+    d.outer_radius = std::clamp(d.outer_radius, 0.0f, 1.0f);
+    d.inner_radius = std::clamp(d.inner_radius, 0.0f, d.outer_radius);
+    d.grid_size = std::min(d.grid_size, std::uint32_t{ max_grid_size });
+    d.grid_jitter = std::clamp(d.grid_jitter, 0.0f, 1.0f);
+
+    ImGui::PopID();
+}
+
 auto
 App::find_closest_point(glm::vec2 const pos,
                         float const max_search_radius) const
     -> std::optional<std::size_t>
 {
     auto const max_rad2 = max_search_radius * max_search_radius;
+    auto const& points = editor_.points();
 
-    if (auto const match = std::ranges::min_element(
-            points_,
-            std::less{},
-            [&](auto const point) { return glm::length2(point - pos); });
-        match != points_.end() and glm::length2(*match - pos) <= max_rad2)
+    if (auto const match = algorithm::batch::closest_point(points, pos);
+        match != points.size() and
+        glm::length2(points[match] - pos) <= max_rad2)
     {
-        return std::distance(points_.begin(), match);
+        return match;
     }
 
     return std::nullopt;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <limits>
 #include <optional>
 #include <random>
@@ -10,16 +11,16 @@
 #include <glpp/glfw/window.hpp>
 #include <imgui.h>
 
-#include <pa093/algorithm/convex_hull/gift_wrapping.hpp>
-#include <pa093/algorithm/convex_hull/graham_scan.hpp>
-#include <pa093/algorithm/kd_tree/build_kd_tree.hpp>
-#include <pa093/algorithm/triangulation/delaunay.hpp>
-#include <pa093/algorithm/triangulation/dual_graph.hpp>
-#include <pa093/algorithm/triangulation/sweep_line.hpp>
-#include <pa093/datastructure/kd_tree.hpp>
+#include <pa093/generator/point_generator.hpp>
+#include <pa093/memory/frame_arena.hpp>
 #include <pa093/render/mesh.hpp>
 #include <pa093/render/shader_cache.hpp>
+#include <pa093/scene/scene_editor.hpp>
+#include <pa093/scene/scene_input.hpp>
+#include <pa093/scene/scene_worker.hpp>
 #include <pa093/visualization/kd_tree.hpp>
+#include <pa093/visualization/point_lod.hpp>
+#include <pa093/visualization/scene_renderer.hpp>
 
 namespace pa093
 {
@@ -42,27 +43,30 @@ public:
 
     void draw_scene();
 
-private:
-    enum class PolygonMode : int
-    {
-        none = 0,
-        all_points,
-        gift_wrapping_convex_hull,
-        graham_scan_convex_hull,
-    };
-
-    enum class TriangulationMode : int
+    /**
+     * Whether frames should be drawn even without new events, e.g. to
+     * measure frame times; otherwise the frame loop waits for events
+     */
+    [[nodiscard]] auto redraw_continuously() const noexcept -> bool
     {
-        none = 0,
-        sweep_line,
-        delaunay,
-        delaunay_plus_voronoi,
-    };
+        return redraw_continuously_;
+    }
 
-    enum class PartitioningMode : int
+private:
+    using PolygonMode = scene::PolygonMode;
+    using TriangulationMode = scene::TriangulationMode;
+    using GraphMode = scene::GraphMode;
+    using PartitioningMode = scene::PartitioningMode;
+
+    /**
+     * Versions of the points and k-D tree currently uploaded to the meshes;
+     * 0 if nothing or an outdated view is uploaded
+     */
+    struct UploadedVersions
     {
-        none = 0,
-        kd_tree,
+        std::uint64_t points = 0u;
+        std::uint64_t point_lod = 0u;
+        std::uint64_t kd_tree = 0u;
     };
 
     static constexpr auto font_size_pixels_unscaled = 13.0f;
@@ -72,72 +76,84 @@ private:
     static constexpr auto polygon_color = glm::vec4(1.0f, 0.0f, 0.0f, 1.0f);
     static constexpr auto triangle_color = glm::vec4(1.0f, 1.0f, 0.0f, 1.0f);
     static constexpr auto voronoi_color = glm::vec4(0.0f, 1.0f, 1.0f, 1.0f);
+    static constexpr auto graph_color = glm::vec4(1.0f, 0.5f, 0.0f, 1.0f);
     static constexpr auto kd_tree_vertical_color =
         glm::vec4(0.3f, 1.0f, 0.3f, 1.0f);
     static constexpr auto kd_tree_horizontal_color =
         glm::vec4(1.0f, 0.0f, 1.0f, 1.0f);
     static constexpr auto point_highlight_radius = 0.05f;
-    static constexpr auto max_generated_points = 1'000;
-    static constexpr auto voronoi_hull_edge_length = 3.0f;
-
-    // Algorithms
-    algorithm::convex_hull::GiftWrapping gift_wrapping_;
-    algorithm::convex_hull::GrahamScan graham_scan_;
-    algorithm::kd_tree::BuildKDTree2f build_kd_tree_;
-    algorithm::triangulation::SweepLine sweep_line_;
-    algorithm::triangulation::Delaunay delaunay_;
-    algorithm::triangulation::DualGraph voronoi_{ voronoi_hull_edge_length };
-
-    // Datastructures
-    datastructure::KDTree2f kd_tree_;
+    static constexpr auto max_generated_points = 10'000'000;
+    static constexpr auto max_clusters = 256;
+    static constexpr auto max_grid_size = 4'096;
+    /**
+     * Larger point sets are drawn at the level of detail of the framebuffer
+     */
+    static constexpr auto max_full_detail_points = std::size_t{ 100'000u };
+    static constexpr auto max_alpha = 1.0f;
+    static constexpr auto profiler_plot_width_pixels = 400.0f;
+    static constexpr auto min_profiler_plot_ms = 1.0f;
+    static constexpr auto trace_file_name = "pa093_trace.json";
+    static constexpr auto session_file_name = "pa093_session.txt";
+    static constexpr auto shader_binary_cache_directory = "pa093_shader_cache";
+
+    // Temporaries of the current frame, freed at the start of update()
+    memory::FrameArena frame_arena_;
+
+    // Points and settings, with optional session recording
+    scene::SceneEditor editor_;
+
+    // Scene geometry, computed in the background
+    scene::SceneWorker scene_worker_;
 
     // Render components
-    render::ShaderCache shader_cache_;
-    render::DynamicMesh2d point_mesh_{ shader_cache_ };
+    render::ShaderCache shader_cache_{ shader_binary_cache_directory };
+    render::DynamicMesh2d point_mesh_{
+        shader_cache_,
+        render::DynamicMesh2d::VertexFormat::unorm16,
+    };
     render::DynamicMesh2d highlighted_point_mesh_{ shader_cache_ };
-    render::DynamicMesh2d polygon_mesh_{ shader_cache_ };
-    render::DynamicMesh2d triangle_mesh_{ shader_cache_ };
-    render::DynamicMesh2d voronoi_mesh_{ shader_cache_ };
+    visualization::PointLod point_lod_{ shader_cache_ };
+    visualization::SceneRenderer scene_renderer_{
+        shader_cache_,
+        {
+            polygon_color,
+            voronoi_color,
+            graph_color,
+            triangle_color,
+            polygon_color, // Alpha shape boundary
+        },
+    };
     visualization::KDTree kd_tree_visualization_{ shader_cache_ };
 
     // State
-    std::mt19937_64 rng_;
-    bool scene_dirty_ = false;
     bool gui_hovered_ = false;
+    bool redraw_continuously_ = false;
     int num_points_to_generate_ = 10;
-    PolygonMode polygon_mode_ = PolygonMode::none;
-    TriangulationMode triangulation_mode_ = TriangulationMode::none;
-    PartitioningMode partitioning_mode_ = PartitioningMode::none;
+    generator::PointDistribution point_distribution_;
+    std::uint64_t scene_generation_ = 0u;
+    UploadedVersions uploaded_versions_ = {};
     glm::vec2 framebuffer_size_ = {
         init_window_mode.width,
         init_window_mode.height,
     };
+    bool draw_point_lod_ = false;
     glm::vec2 cursor_pos_ = {};
     std::optional<std::size_t> highlighted_point_ = std::nullopt;
+    std::optional<glm::vec2> uploaded_highlight_ = std::nullopt;
     std::optional<std::size_t> dragged_point_ = std::nullopt;
-    std::vector<glm::vec2> points_ = {};
-    std::vector<glm::vec2> polygon_points_ = {};
-    std::vector<glm::vec2> triangle_points_ = {};
-    std::vector<glm::vec2> voronoi_points_ = {};
 
     // Events
     std::vector<boost::signals2::scoped_connection> event_connections_;
 
-    void set_content_scale(glm::vec2 scale);
-
-    void set_polygon_mode(PolygonMode mode);
+    void draw_profiler();
 
-    void set_triangulation_mode(TriangulationMode mode);
-
-    void set_partitioning_mode(PartitioningMode mode);
-
-    void add_point(glm::vec2 pos);
+    void set_content_scale(glm::vec2 scale);
 
-    void remove_point(std::size_t point_index);
+    void submit_scene();
 
-    void remove_all_points();
+    void show_scene_geometry(scene::SceneGeometry const& geometry);
 
-    void generate_random_points(std::size_t count);
+    void show_point_distribution_settings();
 
     [[nodiscard]] auto point_from_screen_coords(glm::vec2 screen_coords) const
         -> glm::vec2;
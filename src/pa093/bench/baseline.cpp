@@ -0,0 +1,150 @@
+#include <pa093/bench/baseline.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include <fmt/format.h>
+
+namespace pa093::bench
+{
+
+auto
+BenchmarkResult::points_per_second() const noexcept -> double
+{
+    return static_cast<double>(size) / (measurement.median_ns * 1e-9);
+}
+
+namespace
+{
+
+/**
+ * Per point counter values and derived ratios
+ */
+auto
+counters_to_json(BenchmarkResult const& result) -> nlohmann::json
+{
+    auto const& counters = result.measurement.counters;
+    auto const value = [&](Counter const counter)
+    { return counters[static_cast<std::size_t>(counter)]; };
+    auto const points = static_cast<double>(result.size);
+
+    auto json = nlohmann::json::object();
+
+    for (auto i = std::size_t{ 0 }; i < num_counters; ++i)
+    {
+        if (counters[i])
+        {
+            json[fmt::format("{}_per_point", counter_names[i])] =
+                *counters[i] / points;
+        }
+    }
+
+    if (value(Counter::cycles) and value(Counter::instructions) and
+        *value(Counter::cycles) > 0.0)
+    {
+        json["ipc"] =
+            *value(Counter::instructions) / *value(Counter::cycles);
+    }
+
+    return json;
+}
+
+} // namespace
+
+auto
+to_json(std::span<BenchmarkResult const> const results) -> nlohmann::json
+{
+    auto json_results = nlohmann::json::array();
+
+    for (auto const& result : results)
+    {
+        auto& json_result = json_results.emplace_back(nlohmann::json{
+            { "benchmark", result.benchmark },
+            { "distribution", result.distribution },
+            { "size", result.size },
+            { "iterations", result.measurement.iterations },
+            { "min_ns", result.measurement.min_ns },
+            { "median_ns", result.measurement.median_ns },
+            { "points_per_second", result.points_per_second() },
+            { "output_size", result.measurement.output_size },
+        });
+
+        if (auto counters = counters_to_json(result); not counters.empty())
+        {
+            json_result["counters"] = std::move(counters);
+        }
+    }
+
+    return { { "results", std::move(json_results) } };
+}
+
+auto
+read_results(std::filesystem::path const& path) -> std::vector<BenchmarkResult>
+{
+    auto file = std::ifstream{ path };
+    if (not file)
+    {
+        throw std::runtime_error{ fmt::format("Cannot open results {}",
+                                              path.string()) };
+    }
+
+    auto results = std::vector<BenchmarkResult>{};
+
+    try
+    {
+        auto const json = nlohmann::json::parse(file);
+
+        for (auto const& json_result : json.at("results"))
+        {
+            results.push_back({
+                .benchmark = json_result.at("benchmark"),
+                .distribution = json_result.at("distribution"),
+                .size = json_result.at("size"),
+                .measurement = {
+                    .iterations = json_result.at("iterations"),
+                    .min_ns = json_result.at("min_ns"),
+                    .median_ns = json_result.at("median_ns"),
+                    .output_size = json_result.at("output_size"),
+                },
+            });
+        }
+    }
+    catch (nlohmann::json::exception const& error)
+    {
+        throw std::runtime_error{ fmt::format(
+            "Invalid results {}: {}", path.string(), error.what()) };
+    }
+
+    return results;
+}
+
+auto
+compare(std::span<BenchmarkResult const> const results,
+        std::span<BenchmarkResult const> const baseline)
+    -> std::vector<Comparison>
+{
+    auto const key = [](BenchmarkResult const& result)
+    { return std::tie(result.benchmark, result.distribution, result.size); };
+
+    auto comparisons = std::vector<Comparison>{};
+
+    for (auto const& result : results)
+    {
+        auto const it = std::ranges::find_if(
+            baseline,
+            [&](BenchmarkResult const& other)
+            { return key(other) == key(result); });
+
+        if (it != baseline.end() and it->measurement.median_ns > 0.0)
+        {
+            comparisons.push_back({ &result, it->measurement.median_ns });
+        }
+    }
+
+    return comparisons;
+}
+
+} // namespace pa093::bench
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <pa093/bench/harness.hpp>
+
+namespace pa093::bench
+{
+
+struct BenchmarkResult
+{
+    std::string benchmark;
+    std::string distribution;
+    std::size_t size = 0u;
+    Measurement measurement;
+
+    [[nodiscard]] auto points_per_second() const noexcept -> double;
+};
+
+[[nodiscard]] auto
+to_json(std::span<BenchmarkResult const> results) -> nlohmann::json;
+
+/**
+ * Reads results written by to_json(). Throws std::runtime_error if the file
+ * cannot be read or parsed.
+ */
+[[nodiscard]] auto
+read_results(std::filesystem::path const& path) -> std::vector<BenchmarkResult>;
+
+struct Comparison
+{
+    BenchmarkResult const* result;
+    double baseline_median_ns;
+
+    /**
+     * Current over baseline median time; > 1 means slower
+     */
+    [[nodiscard]] auto ratio() const noexcept -> double
+    {
+        return result->measurement.median_ns / baseline_median_ns;
+    }
+};
+
+/**
+ * Pairs results with the baseline results of the same benchmark,
+ * distribution and size. Results missing from the baseline are skipped.
+ */
+[[nodiscard]] auto
+compare(std::span<BenchmarkResult const> results,
+        std::span<BenchmarkResult const> baseline) -> std::vector<Comparison>;
+
+} // namespace pa093::bench
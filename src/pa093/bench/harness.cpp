@@ -0,0 +1,29 @@
+#include <pa093/bench/harness.hpp>
+
+#include <algorithm>
+
+namespace pa093::bench
+{
+
+auto
+summarize(std::vector<double>& samples_ns, std::size_t const output_size)
+    -> Measurement
+{
+    if (samples_ns.empty())
+    {
+        return {};
+    }
+
+    auto const middle = samples_ns.begin() +
+                        static_cast<std::ptrdiff_t>(samples_ns.size() / 2u);
+    std::ranges::nth_element(samples_ns, middle);
+
+    return {
+        .iterations = samples_ns.size(),
+        .min_ns = *std::ranges::min_element(samples_ns),
+        .median_ns = *middle,
+        .output_size = output_size,
+    };
+}
+
+} // namespace pa093::bench
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include <pa093/bench/perf_counters.hpp>
+
+namespace pa093::bench
+{
+
+struct HarnessOptions
+{
+    /** Keep running until this much time was spent... */
+    std::chrono::duration<double> min_time{ 0.5 };
+    /** ...and at least this many iterations were done */
+    std::size_t min_iterations = 1u;
+    std::size_t max_iterations = 1'000u;
+};
+
+struct Measurement
+{
+    std::size_t iterations = 0u;
+    double min_ns = 0.0;
+    double median_ns = 0.0;
+    /** Output size of the last iteration, so the work cannot be elided */
+    std::size_t output_size = 0u;
+    /** Hardware counter values per iteration, if measured */
+    CounterValues counters = {};
+};
+
+/**
+ * Summarizes per-iteration times in nanoseconds
+ */
+[[nodiscard]] auto
+summarize(std::vector<double>& samples_ns, std::size_t output_size)
+    -> Measurement;
+
+/**
+ * Calls f repeatedly (f returns the size of its output) and measures the
+ * wall time of each call, and the hardware counters over all calls if
+ * counters are given.
+ */
+template<typename F>
+requires std::convertible_to<std::invoke_result_t<F&>, std::size_t>
+[[nodiscard]] auto
+measure(F&& f,
+        HarnessOptions const& options = {},
+        PerfCounters* const counters = nullptr) -> Measurement
+{
+    using clock_type = std::chrono::steady_clock;
+
+    auto samples_ns = std::vector<double>{};
+    auto output_size = std::size_t{ 0 };
+    auto total = clock_type::duration::zero();
+
+    if (counters)
+    {
+        counters->start();
+    }
+
+    while (samples_ns.size() < options.max_iterations and
+           (samples_ns.size() < options.min_iterations or
+            total < options.min_time))
+    {
+        auto const start = clock_type::now();
+        output_size = f();
+        auto const time = clock_type::now() - start;
+
+        total += time;
+        samples_ns.push_back(
+            std::chrono::duration<double, std::nano>{ time }.count());
+    }
+
+    auto const counter_totals =
+        counters ? counters->stop() : CounterValues{};
+    auto measurement = summarize(samples_ns, output_size);
+
+    for (auto i = std::size_t{ 0 }; i < num_counters; ++i)
+    {
+        if (counter_totals[i])
+        {
+            measurement.counters[i] =
+                *counter_totals[i] /
+                static_cast<double>(measurement.iterations);
+        }
+    }
+
+    return measurement;
+}
+
+} // namespace pa093::bench
@@ -0,0 +1,465 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <optional>
+#include <iostream>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+#include <glm/glm.hpp>
+#include <lyra/lyra.hpp>
+#include <spdlog/spdlog.h>
+
+#include <pa093/algorithm/batch.hpp>
+#include <pa093/algorithm/constants.hpp>
+#include <pa093/algorithm/convex_hull/gift_wrapping.hpp>
+#include <pa093/algorithm/convex_hull/graham_scan.hpp>
+#include <pa093/algorithm/kd_tree/build_kd_tree.hpp>
+#include <pa093/algorithm/triangulation/delaunay.hpp>
+#include <pa093/algorithm/triangulation/dual_graph.hpp>
+#include <pa093/algorithm/triangulation/indexed_delaunay.hpp>
+#include <pa093/algorithm/triangulation/sweep_line.hpp>
+#include <pa093/bench/baseline.hpp>
+#include <pa093/bench/harness.hpp>
+#include <pa093/bench/perf_counters.hpp>
+#include <pa093/bench/point_distributions.hpp>
+#include <pa093/concurrency/job_system.hpp>
+#include <pa093/datastructure/kd_tree.hpp>
+#include <pa093/datastructure/triangulation.hpp>
+
+namespace
+{
+
+using namespace pa093;
+using bench::Distribution;
+using point_list = std::vector<glm::vec2>;
+
+/**
+ * Runs an algorithm once and returns the size of its output
+ */
+using Run = std::function<std::size_t()>;
+
+struct Benchmark
+{
+    std::string_view name;
+    /**
+     * Largest input size worth running, to keep the algorithms with
+     * quadratic running time from dominating the suite
+     */
+    std::size_t (*max_size)(Distribution);
+    /**
+     * Prepares the algorithm input from the points (untimed)
+     */
+    Run (*prepare)(point_list const& points);
+};
+
+constexpr auto largest_size = std::size_t{ 10'000'000 };
+constexpr auto max_quadratic_size = std::size_t{ 10'000 };
+
+/**
+ * Returns a run of a point list algorithm that owns its input and output,
+ * so that the algorithm's scratch memory is reused between iterations.
+ */
+template<typename Algorithm>
+auto
+point_list_run(point_list input, Algorithm algorithm = Algorithm{}) -> Run
+{
+    return [input = std::move(input),
+            algorithm = std::move(algorithm),
+            output = point_list{}]() mutable
+    {
+        output.clear();
+        algorithm(input, std::back_inserter(output));
+        return output.size();
+    };
+}
+
+template<typename Algorithm>
+auto
+convex_hull(point_list const& points) -> point_list
+{
+    auto hull = point_list{};
+    Algorithm{}(points, std::back_inserter(hull));
+    return hull;
+}
+
+auto
+delaunay_triangles(point_list const& points) -> point_list
+{
+    auto triangles = point_list{};
+    algorithm::triangulation::Delaunay{}(points, std::back_inserter(triangles));
+    return triangles;
+}
+
+/**
+ * Snaps the points to the integer grid, with [-1, 1] spanning half the
+ * coordinate range of exact grid predicates
+ */
+auto
+grid_points(point_list const& points) -> std::vector<glm::ivec2>
+{
+    constexpr auto limit =
+        static_cast<float>(algorithm::constants::max_grid_coordinate);
+    constexpr auto scale = limit / 2.0f;
+
+    auto grid = std::vector<glm::ivec2>(points.size());
+    std::ranges::transform(points,
+                           grid.begin(),
+                           [](glm::vec2 const p)
+                           {
+                               return glm::ivec2(glm::clamp(
+                                   glm::round(p * scale), -limit, limit));
+                           });
+    return grid;
+}
+
+constexpr auto voronoi_hull_edge_length = 3.0f;
+
+constexpr auto benchmarks = std::array{
+    Benchmark{
+        .name = "GiftWrapping",
+        // Quadratic if all points are on the hull
+        .max_size = [](Distribution const distribution)
+        {
+            return distribution == Distribution::circle ? max_quadratic_size
+                                                        : largest_size;
+        },
+        .prepare = [](point_list const& points)
+        {
+            return point_list_run<algorithm::convex_hull::GiftWrapping>(
+                points);
+        },
+    },
+    Benchmark{
+        .name = "GrahamScan",
+        .max_size = [](Distribution) { return largest_size; },
+        .prepare = [](point_list const& points)
+        {
+            return point_list_run<algorithm::convex_hull::GrahamScan>(points);
+        },
+    },
+    Benchmark{
+        .name = "SweepLine",
+        .max_size = [](Distribution) { return largest_size; },
+        // Triangulates the convex hull of the points
+        .prepare = [](point_list const& points)
+        {
+            return point_list_run<algorithm::triangulation::SweepLine>(
+                convex_hull<algorithm::convex_hull::GrahamScan>(points));
+        },
+    },
+    Benchmark{
+        .name = "Delaunay",
+        .max_size = [](Distribution) { return max_quadratic_size; },
+        .prepare = [](point_list const& points)
+        {
+            return point_list_run<algorithm::triangulation::Delaunay>(points);
+        },
+    },
+    Benchmark{
+        .name = "IndexedDelaunay",
+        .max_size = [](Distribution) { return largest_size; },
+        .prepare = [](point_list const& points) -> Run
+        {
+            return [points,
+                    algorithm = algorithm::triangulation::IndexedDelaunay{},
+                    triangulation = datastructure::Triangulation{}]() mutable
+            {
+                algorithm(points, triangulation);
+                return triangulation.num_triangles();
+            };
+        },
+    },
+    Benchmark{
+        .name = "GridIndexedDelaunay",
+        .max_size = [](Distribution) { return largest_size; },
+        .prepare = [](point_list const& points) -> Run
+        {
+            return [points = grid_points(points),
+                    algorithm = algorithm::triangulation::GridIndexedDelaunay{},
+                    triangulation =
+                        datastructure::GridTriangulation{}]() mutable
+            {
+                algorithm(points, triangulation);
+                return triangulation.num_triangles();
+            };
+        },
+    },
+    Benchmark{
+        .name = "DualGraph",
+        .max_size = [](Distribution) { return max_quadratic_size; },
+        .prepare = [](point_list const& points)
+        {
+            return point_list_run(delaunay_triangles(points),
+                                  algorithm::triangulation::DualGraph{
+                                      voronoi_hull_edge_length,
+                                  });
+        },
+    },
+    Benchmark{
+        .name = "BuildKDTree",
+        .max_size = [](Distribution) { return largest_size; },
+        .prepare = [](point_list const& points) -> Run
+        {
+            return [points,
+                    algorithm = algorithm::kd_tree::BuildKDTree2f{},
+                    tree = datastructure::KDTree2f{}]() mutable
+            {
+                algorithm(points, tree);
+                return std::ranges::size(tree.points());
+            };
+        },
+    },
+};
+
+struct Options
+{
+    std::string output;
+    std::string baseline;
+    std::string filter;
+    std::size_t max_size = largest_size;
+    double min_time = 0.5;
+    double threshold = 10.0;
+    bool counters = false;
+};
+
+void
+log_counters(bench::BenchmarkResult const& result)
+{
+    using bench::Counter;
+
+    auto const& counters = result.measurement.counters;
+    auto const value = [&](Counter const counter)
+    { return counters[static_cast<std::size_t>(counter)]; };
+    auto line = std::string{};
+
+    if (value(Counter::cycles) and value(Counter::instructions))
+    {
+        line += fmt::format(" IPC {:.2f},",
+                            *value(Counter::instructions) /
+                                *value(Counter::cycles));
+    }
+    for (auto i = std::size_t{ 0 }; i < bench::num_counters; ++i)
+    {
+        if (counters[i])
+        {
+            line += fmt::format(" {:.3g} {}/point,",
+                                *counters[i] /
+                                    static_cast<double>(result.size),
+                                bench::counter_names[i]);
+        }
+    }
+
+    if (not line.empty())
+    {
+        line.pop_back();
+        spdlog::info("{:>46}{}", "", line);
+    }
+}
+
+auto
+run_benchmarks(Options const& options) -> std::vector<bench::BenchmarkResult>
+{
+    auto results = std::vector<bench::BenchmarkResult>{};
+    auto counters = std::optional<bench::PerfCounters>{};
+    auto const harness_options = bench::HarnessOptions{
+        .min_time = std::chrono::duration<double>{ options.min_time },
+    };
+
+    spdlog::info("Batch kernels: {}",
+                 algorithm::batch::instruction_set_name(
+                     algorithm::batch::supported_instruction_set()));
+
+    if (options.counters)
+    {
+        // Start the job system workers first, so that the counters are
+        // opened for them as well; the algorithms run on them too
+        auto const& jobs = concurrency::JobSystem::instance();
+
+        counters.emplace();
+        if (not counters->available())
+        {
+            spdlog::warn("Hardware counters unavailable ({}), measuring "
+                         "time only",
+                         counters->error());
+            counters.reset();
+        }
+        else
+        {
+            spdlog::info("Hardware counters: summed over all {} threads of "
+                         "the process, {} of them running jobs",
+                         counters->num_threads(),
+                         jobs.thread_count());
+        }
+    }
+
+    for (auto const& [distribution_name, distribution] :
+         bench::distribution_names)
+    {
+        for (auto size = std::size_t{ 100 }; size <= options.max_size;
+             size *= 10u)
+        {
+            auto const points = bench::generate_points(distribution, size);
+
+            for (auto const& benchmark : benchmarks)
+            {
+                auto const matches_filter =
+                    benchmark.name.find(options.filter) !=
+                    std::string_view::npos;
+                if (size > benchmark.max_size(distribution) or
+                    not matches_filter)
+                {
+                    continue;
+                }
+
+                try
+                {
+                    auto run = benchmark.prepare(points);
+                    auto const& result = results.emplace_back(
+                        bench::BenchmarkResult{
+                            .benchmark = std::string{ benchmark.name },
+                            .distribution = std::string{ distribution_name },
+                            .size = size,
+                            .measurement = bench::measure(
+                                run,
+                                harness_options,
+                                counters ? &*counters : nullptr),
+                        });
+
+                    spdlog::info("{:<16} {:<18} {:>9}: {:>14.0f} ns, "
+                                 "{:>12.4g} points/s ({} iterations)",
+                                 result.benchmark,
+                                 result.distribution,
+                                 result.size,
+                                 result.measurement.median_ns,
+                                 result.points_per_second(),
+                                 result.measurement.iterations);
+                    log_counters(result);
+                }
+                catch (std::exception const& error)
+                {
+                    spdlog::error("{} {} {}: {}",
+                                  benchmark.name,
+                                  distribution_name,
+                                  size,
+                                  error.what());
+                }
+            }
+        }
+    }
+
+    return results;
+}
+
+/**
+ * Logs comparisons with the baseline; returns the number of regressions.
+ */
+auto
+report_comparisons(std::span<bench::BenchmarkResult const> const results,
+                   Options const& options) -> std::size_t
+{
+    auto const baseline = bench::read_results(options.baseline);
+    auto const max_ratio = 1.0 + options.threshold / 100.0;
+    auto num_regressions = std::size_t{ 0 };
+
+    for (auto const& comparison : bench::compare(results, baseline))
+    {
+        auto const& result = *comparison.result;
+        auto const change = (comparison.ratio() - 1.0) * 100.0;
+
+        if (comparison.ratio() > max_ratio)
+        {
+            ++num_regressions;
+            spdlog::warn("Regression: {} {} {}: {:+.1f}%",
+                         result.benchmark,
+                         result.distribution,
+                         result.size,
+                         change);
+        }
+        else if (comparison.ratio() < 1.0 / max_ratio)
+        {
+            spdlog::info("Improvement: {} {} {}: {:+.1f}%",
+                         result.benchmark,
+                         result.distribution,
+                         result.size,
+                         change);
+        }
+    }
+
+    return num_regressions;
+}
+
+} // namespace
+
+auto
+main(int const argc, char const* const* const argv) -> int
+{
+    try
+    {
+        auto options = Options{};
+        auto show_help = false;
+
+        auto const parser =
+            lyra::cli{} | lyra::help(show_help) |
+            lyra::opt(options.output, "path")["-o"]["--output"](
+                "JSON file to write the results to") |
+            lyra::opt(options.baseline, "path")["-b"]["--baseline"](
+                "Results to compare against; exits with failure on "
+                "regressions") |
+            lyra::opt(options.threshold, "percent")["-t"]["--threshold"](
+                "Slowdown relative to the baseline reported as a regression") |
+            lyra::opt(options.filter, "text")["-f"]["--filter"](
+                "Only run benchmarks whose name contains the text") |
+            lyra::opt(options.max_size, "count")["-n"]["--max-size"](
+                "Largest number of points") |
+            lyra::opt(options.min_time, "seconds")["--min-time"](
+                "Minimum time spent measuring each case") |
+            lyra::opt(options.counters)["--counters"](
+                "Also read hardware performance counters");
+
+        auto const parsed = parser.parse({ argc, argv });
+        if (show_help)
+        {
+            std::cout << parser << '\n';
+            return EXIT_SUCCESS;
+        }
+        if (not parsed)
+        {
+            throw std::runtime_error{ parsed.message() };
+        }
+
+        auto const results = run_benchmarks(options);
+
+        if (not options.output.empty())
+        {
+            auto file = std::ofstream{ options.output };
+            if (not(file << bench::to_json(results).dump(2) << '\n'))
+            {
+                throw std::runtime_error{ fmt::format(
+                    "Cannot write results to {}", options.output) };
+            }
+        }
+
+        if (not options.baseline.empty() and
+            report_comparisons(results, options) != 0u)
+        {
+            return EXIT_FAILURE;
+        }
+
+        return EXIT_SUCCESS;
+    }
+    catch (std::exception const& error)
+    {
+        spdlog::error("{0}", error.what());
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,232 @@
+#include <pa093/bench/perf_counters.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace pa093::bench
+{
+
+#ifdef __linux__
+
+namespace
+{
+
+struct CounterConfig
+{
+    std::uint32_t type;
+    std::uint64_t config;
+};
+
+constexpr auto counter_configs = std::array<CounterConfig, num_counters>{ {
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    { PERF_TYPE_HW_CACHE,
+      PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8u) |
+          (PERF_COUNT_HW_CACHE_RESULT_MISS << 16u) },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+} };
+
+struct ReadFormat
+{
+    std::uint64_t value;
+    std::uint64_t time_enabled;
+    std::uint64_t time_running;
+};
+
+[[nodiscard]] auto
+open_counter(CounterConfig const& counter, pid_t const thread) noexcept -> int
+{
+    auto attr = perf_event_attr{};
+    attr.size = sizeof(attr);
+    attr.type = counter.type;
+    attr.config = counter.config;
+    attr.disabled = 1;
+    attr.inherit = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format =
+        PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    return static_cast<int>(::syscall(
+        SYS_perf_event_open, &attr, thread, -1, -1, PERF_FLAG_FD_CLOEXEC));
+}
+
+/**
+ * Thread ids of the process; just the calling thread if they cannot be
+ * listed
+ */
+[[nodiscard]] auto
+process_threads() -> std::vector<pid_t>
+{
+    auto threads = std::vector<pid_t>{};
+    auto error = std::error_code{};
+
+    for (auto const& entry :
+         std::filesystem::directory_iterator{ "/proc/self/task", error })
+    {
+        auto const name = entry.path().filename().string();
+        auto thread = pid_t{};
+        if (auto const [end, result] = std::from_chars(
+                name.data(), name.data() + name.size(), thread);
+            result == std::errc{} and end == name.data() + name.size())
+        {
+            threads.push_back(thread);
+        }
+    }
+
+    if (threads.empty())
+    {
+        threads.push_back(0);
+    }
+
+    return threads;
+}
+
+void
+close_all(std::vector<int>& fds) noexcept
+{
+    for (auto const fd : fds)
+    {
+        ::close(fd);
+    }
+    fds.clear();
+}
+
+} // namespace
+
+PerfCounters::PerfCounters()
+{
+    auto const threads = process_threads();
+    auto first_errno = 0;
+
+    num_threads_ = threads.size();
+
+    for (auto i = std::size_t{ 0 }; i < num_counters; ++i)
+    {
+        for (auto const thread : threads)
+        {
+            auto const fd = open_counter(counter_configs[i], thread);
+            if (fd >= 0)
+            {
+                fds_[i].push_back(fd);
+            }
+            else if (errno != ESRCH)
+            {
+                // A counter missing on some threads would undercount, so
+                // leave it out entirely. Threads that exited in the meantime
+                // are skipped.
+                if (first_errno == 0)
+                {
+                    first_errno = errno;
+                }
+                close_all(fds_[i]);
+                break;
+            }
+        }
+    }
+
+    if (not available())
+    {
+        error_ = std::strerror(first_errno);
+    }
+}
+
+PerfCounters::~PerfCounters()
+{
+    for (auto& counter_fds : fds_)
+    {
+        close_all(counter_fds);
+    }
+}
+
+void
+PerfCounters::start() noexcept
+{
+    for (auto const& counter_fds : fds_)
+    {
+        for (auto const fd : counter_fds)
+        {
+            ::ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ::ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+}
+
+auto
+PerfCounters::stop() noexcept -> CounterValues
+{
+    for (auto const& counter_fds : fds_)
+    {
+        for (auto const fd : counter_fds)
+        {
+            ::ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+
+    auto values = CounterValues{};
+
+    for (auto i = std::size_t{ 0 }; i < num_counters; ++i)
+    {
+        for (auto const fd : fds_[i])
+        {
+            auto data = ReadFormat{};
+            if (::read(fd, &data, sizeof(data)) != sizeof(data) or
+                data.time_running == 0u)
+            {
+                continue;
+            }
+
+            // Extrapolate if the counter only ran part of the time
+            values[i] = values[i].value_or(0.0) +
+                        static_cast<double>(data.value) *
+                            static_cast<double>(data.time_enabled) /
+                            static_cast<double>(data.time_running);
+        }
+    }
+
+    return values;
+}
+
+#else
+
+PerfCounters::PerfCounters()
+    : error_{ "Hardware counters are only supported on Linux" }
+{
+}
+
+PerfCounters::~PerfCounters() = default;
+
+void
+PerfCounters::start() noexcept
+{
+}
+
+auto
+PerfCounters::stop() noexcept -> CounterValues
+{
+    return {};
+}
+
+#endif
+
+auto
+PerfCounters::available() const noexcept -> bool
+{
+    return std::ranges::any_of(fds_,
+                               [](std::vector<int> const& counter_fds)
+                               { return not counter_fds.empty(); });
+}
+
+} // namespace pa093::bench
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace pa093::bench
+{
+
+enum class Counter
+{
+    cycles,
+    instructions,
+    l1d_misses,
+    llc_misses,
+    branch_misses,
+};
+
+inline constexpr auto num_counters = std::size_t{ 5 };
+
+inline constexpr auto counter_names =
+    std::array<std::string_view, num_counters>{
+        "cycles", "instructions", "l1d_misses", "llc_misses", "branch_misses",
+    };
+
+/**
+ * Values of the counters that could be opened, indexed by Counter
+ */
+using CounterValues = std::array<std::optional<double>, num_counters>;
+
+/**
+ * Hardware performance counters of all threads of the process (Linux
+ * perf_event_open, user space only), so that work run on job system
+ * workers is counted too. Each counter is opened for every existing thread
+ * and inherited by threads created later; the values are summed.
+ *
+ * Counters the kernel or the container does not allow for every thread are
+ * left out; if none can be opened, available() is false and stop() returns
+ * no values.
+ */
+class PerfCounters
+{
+public:
+    [[nodiscard]] PerfCounters();
+
+    PerfCounters(PerfCounters const&) = delete;
+
+    auto operator=(PerfCounters const&) -> PerfCounters& = delete;
+
+    ~PerfCounters();
+
+    [[nodiscard]] auto available() const noexcept -> bool;
+
+    /**
+     * Threads the counters were opened for, not counting threads created
+     * later
+     */
+    [[nodiscard]] auto num_threads() const noexcept -> std::size_t
+    {
+        return num_threads_;
+    }
+
+    /**
+     * Why no counter could be opened; empty if some are available
+     */
+    [[nodiscard]] auto error() const noexcept -> std::string const&
+    {
+        return error_;
+    }
+
+    /**
+     * Resets and enables the counters
+     */
+    void start() noexcept;
+
+    /**
+     * Disables the counters and returns their values since start(), scaled
+     * up if the kernel had to multiplex them.
+     */
+    [[nodiscard]] auto stop() noexcept -> CounterValues;
+
+private:
+    // Per counter, a file descriptor for each thread
+    std::array<std::vector<int>, num_counters> fds_;
+    std::size_t num_threads_ = 0u;
+    std::string error_;
+};
+
+} // namespace pa093::bench
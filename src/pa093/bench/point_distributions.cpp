@@ -0,0 +1,62 @@
+#include <pa093/bench/point_distributions.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#include <pa093/generator/point_generator.hpp>
+
+namespace pa093::bench
+{
+
+namespace
+{
+
+constexpr auto circle_radius = 0.9f;
+constexpr auto copies_per_grid_point = std::size_t{ 4 };
+
+} // namespace
+
+auto
+distribution_name(Distribution const distribution) noexcept
+    -> std::string_view
+{
+    auto const it = std::ranges::find(distribution_names,
+                                      distribution,
+                                      [](auto const& entry)
+                                      { return entry.second; });
+
+    return it != distribution_names.end() ? it->first : std::string_view{};
+}
+
+auto
+generate_points(Distribution const distribution,
+                std::size_t const count,
+                std::uint64_t const seed) -> std::vector<glm::vec2>
+{
+    auto settings = generator::PointDistribution{};
+
+    switch (distribution)
+    {
+        case Distribution::uniform:
+            break;
+        case Distribution::gaussian_clusters:
+            settings.distribution = generator::Distribution::gaussian_clusters;
+            break;
+        case Distribution::circle:
+            settings.distribution = generator::Distribution::annulus;
+            settings.inner_radius = circle_radius;
+            settings.outer_radius = circle_radius;
+            break;
+        case Distribution::grid_duplicates:
+            settings.distribution = generator::Distribution::grid;
+            settings.grid_size = static_cast<std::uint32_t>(std::max(
+                std::size_t{ 2 },
+                static_cast<std::size_t>(std::ceil(std::sqrt(
+                    static_cast<double>(count / copies_per_grid_point))))));
+            break;
+    }
+
+    return generator::generate_points(settings, count, seed);
+}
+
+} // namespace pa093::bench
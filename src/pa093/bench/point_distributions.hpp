@@ -0,0 +1,46 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace pa093::bench
+{
+
+enum class Distribution
+{
+    /** Uniform in [-1, 1]^2 */
+    uniform,
+    /** Normally distributed around a few random centers */
+    gaussian_clusters,
+    /** On a circle, so that every point is on the convex hull */
+    circle,
+    /** On a coarse grid, about four copies of every grid point */
+    grid_duplicates,
+};
+
+inline constexpr auto distribution_names =
+    std::array<std::pair<std::string_view, Distribution>, 4u>{ {
+        { "uniform", Distribution::uniform },
+        { "gaussian_clusters", Distribution::gaussian_clusters },
+        { "circle", Distribution::circle },
+        { "grid_duplicates", Distribution::grid_duplicates },
+    } };
+
+[[nodiscard]] auto
+distribution_name(Distribution distribution) noexcept -> std::string_view;
+
+/**
+ * Generates count points; the same seed always gives the same points.
+ */
+[[nodiscard]] auto
+generate_points(Distribution distribution,
+                std::size_t count,
+                std::uint64_t seed = 0u) -> std::vector<glm::vec2>;
+
+} // namespace pa093::bench
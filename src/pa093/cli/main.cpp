@@ -0,0 +1,368 @@
+#include <algorithm>
+#include <chrono>
+#include <concepts>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+
+#include <pa093/cli/options.hpp>
+#include <pa093/cli/replay.hpp>
+#include <pa093/cli/runner.hpp>
+#include <pa093/generator/point_generator.hpp>
+#include <pa093/io/mapped_file.hpp>
+#include <pa093/io/mesh_writer.hpp>
+#include <pa093/io/point_file.hpp>
+#include <pa093/io/point_set_file.hpp>
+#include <pa093/io/text_points.hpp>
+
+namespace
+{
+
+using clock_type = std::chrono::steady_clock;
+using milliseconds = std::chrono::duration<double, std::milli>;
+
+template<typename F>
+auto
+timed(F&& f) -> milliseconds
+{
+    auto const start = clock_type::now();
+    f();
+    return clock_type::now() - start;
+}
+
+/**
+ * The input file, or a description of the generated points
+ */
+[[nodiscard]] auto
+input_name(pa093::cli::Options const& options) -> std::string
+{
+    if (options.generate == 0u)
+    {
+        return options.input.string();
+    }
+
+    return fmt::format("{} distribution, seed {}",
+                       pa093::generator::distribution_name(
+                           options.distribution),
+                       options.seed);
+}
+
+[[nodiscard]] auto
+generate_points(pa093::cli::Options const& options) -> std::vector<glm::vec2>
+{
+    auto points = std::vector<glm::vec2>{};
+    auto const time = timed(
+        [&]
+        {
+            points = pa093::generator::generate_points(
+                { .distribution = options.distribution },
+                options.generate,
+                options.seed);
+        });
+
+    spdlog::info("Generated {} points ({}) in {:.3f} ms ({:.1f} M points/s)",
+                 points.size(),
+                 input_name(options),
+                 time.count(),
+                 static_cast<double>(points.size()) / 1e3 / time.count());
+
+    return points;
+}
+
+template<typename T>
+void
+load_point_columns(pa093::cli::Options const& options,
+                   pa093::io::PointColumns<T>& columns)
+{
+    auto const load_time = timed(
+        [&]
+        {
+            auto file = pa093::io::MappedFile{ options.input };
+            if (not pa093::io::is_point_set(file.bytes()))
+            {
+                columns = pa093::io::read_text_points<T>(file, options.input);
+                return;
+            }
+
+            auto const point_set =
+                pa093::io::PointSetFile{ std::move(file), options.input };
+            auto const scalar_type = std::same_as<T, float>
+                                         ? pa093::io::ScalarType::float32
+                                         : pa093::io::ScalarType::float64;
+
+            if (point_set.scalar_type() == scalar_type)
+            {
+                // Copy whole columns
+                auto const x = point_set.column<T>(pa093::io::Axis::x);
+                auto const y = point_set.column<T>(pa093::io::Axis::y);
+                columns.x.assign(x.begin(), x.end());
+                columns.y.assign(y.begin(), y.end());
+                return;
+            }
+
+            columns.x.reserve(point_set.size());
+            columns.y.reserve(point_set.size());
+            for (auto const point : point_set.points())
+            {
+                columns.x.push_back(static_cast<T>(point.x));
+                columns.y.push_back(static_cast<T>(point.y));
+            }
+        });
+
+    auto const input_size = std::filesystem::file_size(options.input);
+
+    spdlog::info("Loaded {} points from {} in {:.3f} ms ({:.1f} MB/s)",
+                 columns.x.size(),
+                 options.input.string(),
+                 load_time.count(),
+                 static_cast<double>(input_size) / 1e3 / load_time.count());
+}
+
+template<typename T>
+void
+convert_point_file(pa093::cli::Options const& options)
+{
+    auto columns = pa093::io::PointColumns<T>{};
+
+    if (options.generate != 0u)
+    {
+        auto const points = generate_points(options);
+        columns.x.reserve(points.size());
+        columns.y.reserve(points.size());
+        for (auto const point : points)
+        {
+            columns.x.push_back(static_cast<T>(point.x));
+            columns.y.push_back(static_cast<T>(point.y));
+        }
+    }
+    else
+    {
+        load_point_columns(options, columns);
+    }
+
+    auto const write_time = timed(
+        [&]
+        {
+            if constexpr (std::same_as<T, float>)
+            {
+                if (options.quantize)
+                {
+                    pa093::io::write_quantized_point_set(
+                        options.convert, columns.x, columns.y);
+                    return;
+                }
+            }
+
+            pa093::io::write_point_set<T>(
+                options.convert, columns.x, columns.y);
+        });
+
+    spdlog::info("Wrote point set {} in {:.3f} ms",
+                 options.convert.string(),
+                 write_time.count());
+}
+
+void
+stream_mesh(pa093::cli::Options const& options,
+            pa093::cli::Runner& runner,
+            std::size_t const num_points)
+{
+    using Primitive = pa093::cli::Result::Primitive;
+
+    auto const format = options.mesh.extension() == ".ply"
+                            ? pa093::io::MeshFormat::ply
+                            : pa093::io::MeshFormat::indexed;
+    auto const vertices_per_face =
+        pa093::cli::primitive(options.algorithm) == Primitive::triangles
+            ? 3u
+            : 2u;
+
+    // The vertices of most outputs are input points, or about as many
+    auto mesh = pa093::io::MeshWriter{
+        options.mesh, format, vertices_per_face, true, num_points
+    };
+
+    auto const time = timed(
+        [&]
+        {
+            runner(options.algorithm, mesh);
+            mesh.finish();
+        });
+
+    spdlog::info("Streamed {} to {} in {:.3f} ms: {} vertices, {} faces",
+                 pa093::cli::algorithm_name(options.algorithm),
+                 options.mesh.string(),
+                 time.count(),
+                 mesh.num_vertices(),
+                 mesh.num_faces());
+}
+
+void
+replay_session(pa093::cli::Options const& options)
+{
+    auto const report =
+        pa093::cli::replay_session(options.replay, options.repeat);
+
+    spdlog::info("Replayed {} recomputed frame(s) of {} {} time(s): "
+                 "total {:.3f} ms, median {:.3f} ms, p95 {:.3f} ms, "
+                 "max {:.3f} ms; edits total {:.3f} ms",
+                 report.frames.size(),
+                 options.replay.string(),
+                 options.repeat,
+                 report.total_ms(),
+                 report.percentile_ms(0.5),
+                 report.percentile_ms(0.95),
+                 report.percentile_ms(1.0),
+                 report.total_edit_ms());
+
+    if (options.output.empty())
+    {
+        return;
+    }
+
+    auto json = report.to_json();
+    json["session"] = options.replay.string();
+    json["repeat"] = options.repeat;
+
+    auto file = std::ofstream{ options.output };
+    if (not(file << json << '\n'))
+    {
+        throw std::runtime_error{ fmt::format("Cannot write results to {}",
+                                              options.output.string()) };
+    }
+}
+
+} // namespace
+
+auto
+main(int const argc, char const* const* const argv) -> int
+{
+    try
+    {
+        auto const options = pa093::cli::parse_options(argc, argv);
+        if (not options)
+        {
+            return EXIT_SUCCESS;
+        }
+
+        if (not options->replay.empty())
+        {
+            replay_session(*options);
+            return EXIT_SUCCESS;
+        }
+
+        if (not options->convert.empty())
+        {
+            if (options->double_precision)
+            {
+                convert_point_file<double>(*options);
+            }
+            else
+            {
+                convert_point_file<float>(*options);
+            }
+
+            return EXIT_SUCCESS;
+        }
+
+        auto const algorithm = pa093::cli::algorithm_name(options->algorithm);
+
+        // Load or generate
+        auto points = std::vector<glm::vec2>{};
+        auto load_time = milliseconds::zero();
+        if (options->generate != 0u)
+        {
+            load_time = timed([&] { points = generate_points(*options); });
+        }
+        else
+        {
+            load_time = timed(
+                [&] { points = pa093::io::read_points(options->input); });
+
+            spdlog::info("Loaded {} points from {} in {:.3f} ms",
+                         points.size(),
+                         options->input.string(),
+                         load_time.count());
+        }
+
+        auto runner = pa093::cli::Runner{ points };
+
+        if (not options->mesh.empty())
+        {
+            stream_mesh(*options, runner, points.size());
+            return EXIT_SUCCESS;
+        }
+
+        // Run
+        auto result = pa093::cli::Result{};
+        auto min_time = milliseconds::max();
+        auto total_time = milliseconds::zero();
+
+        for (auto i = std::size_t{ 0 }; i < options->repeat; ++i)
+        {
+            auto const time =
+                timed([&] { runner(options->algorithm, result); });
+
+            min_time = std::min(min_time, time);
+            total_time += time;
+        }
+
+        auto const mean_time = total_time / options->repeat;
+
+        spdlog::info("Ran {} {} time(s): min {:.3f} ms, mean {:.3f} ms, "
+                     "{} output vertices",
+                     algorithm,
+                     options->repeat,
+                     min_time.count(),
+                     mean_time.count(),
+                     result.vertices.size());
+
+        // Write
+        if (options->output.empty())
+        {
+            return EXIT_SUCCESS;
+        }
+
+        auto const write_time = timed(
+            [&]
+            {
+                auto json = result.to_json();
+                json["algorithm"] = algorithm;
+                json["input"] = input_name(*options);
+                json["num_points"] = points.size();
+                json["timing_ms"] = {
+                    { "load", load_time.count() },
+                    { "min", min_time.count() },
+                    { "mean", mean_time.count() },
+                    { "repeat", options->repeat },
+                };
+
+                auto file = std::ofstream{ options->output };
+                if (not(file << json << '\n'))
+                {
+                    throw std::runtime_error{ fmt::format(
+                        "Cannot write results to {}",
+                        options->output.string()) };
+                }
+            });
+
+        spdlog::info("Wrote results to {} in {:.3f} ms",
+                     options->output.string(),
+                     write_time.count());
+
+        return EXIT_SUCCESS;
+    }
+    catch (std::exception const& error)
+    {
+        spdlog::error("{0}", error.what());
+        return EXIT_FAILURE;
+    }
+}
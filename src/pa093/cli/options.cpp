@@ -0,0 +1,152 @@
+#include <pa093/cli/options.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include <fmt/format.h>
+#include <lyra/lyra.hpp>
+
+namespace pa093::cli
+{
+
+auto
+algorithm_name(Algorithm const algorithm) noexcept -> std::string_view
+{
+    auto const it = std::ranges::find(algorithm_names,
+                                      algorithm,
+                                      [](auto const& entry)
+                                      { return entry.second; });
+
+    return it != algorithm_names.end() ? it->first : std::string_view{};
+}
+
+auto
+parse_options(int const argc, char const* const* const argv)
+    -> std::optional<Options>
+{
+    auto show_help = false;
+    auto input = std::string{};
+    auto generate = std::size_t{ 0 };
+    auto distribution = std::string{ generator::distribution_name(
+        generator::Distribution::uniform) };
+    auto seed = std::uint64_t{ 0 };
+    auto output = std::string{};
+    auto convert = std::string{};
+    auto mesh = std::string{};
+    auto replay = std::string{};
+    auto double_precision = false;
+    auto quantize = false;
+    auto algorithm = std::string{ algorithm_name(Algorithm::delaunay) };
+    auto repeat = 1;
+
+    auto algorithm_help = std::string{ "Algorithm to run:" };
+    for (auto const& [name, value] : algorithm_names)
+    {
+        algorithm_help += fmt::format(" {}", name);
+    }
+
+    auto distribution_help = std::string{ "Distribution of generated points:" };
+    for (auto const& [name, value] : generator::distribution_names)
+    {
+        distribution_help += fmt::format(" {}", name);
+    }
+
+    auto const parser =
+        lyra::cli{} | lyra::help(show_help) |
+        lyra::opt(input, "path")["-i"]["--input"]("Point file to load") |
+        lyra::opt(generate, "count")["-g"]["--generate"](
+            "Generate random points instead of loading an input") |
+        lyra::opt(distribution, "name")["--distribution"](distribution_help) |
+        lyra::opt(seed, "seed")["--seed"]("Seed of the generated points") |
+        lyra::opt(output, "path")["-o"]["--output"](
+            "JSON file to write the results to") |
+        lyra::opt(mesh, "path")["-m"]["--mesh"](
+            "Stream triangles or lines to a .ply or indexed mesh file") |
+        lyra::opt(convert, "path")["-c"]["--convert"](
+            "Convert the input to a binary point set instead of running an "
+            "algorithm") |
+        lyra::opt(replay, "path")["--replay"](
+            "Replay a recorded session and time the scene recomputation of "
+            "every frame") |
+        lyra::opt(double_precision)["--double"](
+            "Store converted coordinates as 64-bit floats") |
+        lyra::opt(quantize)["--quantize"](
+            "Store converted coordinates as 16-bit integers over their "
+            "bounding box") |
+        lyra::opt(algorithm, "name")["-a"]["--algorithm"](algorithm_help) |
+        lyra::opt(repeat, "count")["-r"]["--repeat"](
+            "Number of timed runs of the algorithm or session replays");
+
+    auto const result = parser.parse({ argc, argv });
+
+    if (show_help)
+    {
+        std::cout << parser << '\n';
+        return std::nullopt;
+    }
+    if (not result)
+    {
+        throw std::runtime_error{ result.message() };
+    }
+    if (input.empty() and generate == 0u and replay.empty())
+    {
+        throw std::runtime_error{ "Either an input, a number of points to "
+                                  "generate or a session to replay is "
+                                  "required" };
+    }
+    if (not input.empty() and generate != 0u)
+    {
+        throw std::runtime_error{
+            "Points cannot be both loaded and generated"
+        };
+    }
+
+    auto const distribution_it =
+        std::ranges::find(generator::distribution_names,
+                          distribution,
+                          [](auto const& entry) { return entry.first; });
+    if (distribution_it == generator::distribution_names.end())
+    {
+        throw std::runtime_error{ fmt::format("Unknown distribution {}",
+                                              distribution) };
+    }
+
+    auto const it = std::ranges::find(algorithm_names,
+                                      algorithm,
+                                      [](auto const& entry)
+                                      { return entry.first; });
+    if (it == algorithm_names.end())
+    {
+        throw std::runtime_error{ fmt::format("Unknown algorithm {}",
+                                              algorithm) };
+    }
+    if (double_precision and quantize)
+    {
+        throw std::runtime_error{
+            "Converted coordinates cannot be both 64-bit and quantized"
+        };
+    }
+    if (repeat < 1)
+    {
+        throw std::runtime_error{ "Repeat count must be positive" };
+    }
+
+    return Options{
+        .input = input,
+        .generate = generate,
+        .distribution = distribution_it->second,
+        .seed = seed,
+        .output = output,
+        .convert = convert,
+        .mesh = mesh,
+        .replay = replay,
+        .double_precision = double_precision,
+        .quantize = quantize,
+        .algorithm = it->second,
+        .repeat = static_cast<std::size_t>(repeat),
+    };
+}
+
+} // namespace pa093::cli
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#include <pa093/generator/point_generator.hpp>
+
+namespace pa093::cli
+{
+
+enum class Algorithm
+{
+    gift_wrapping,
+    graham_scan,
+    sweep_line,
+    delaunay,
+    voronoi,
+    voronoi_cells,
+    kd_tree,
+    euclidean_mst,
+    closest_pair,
+};
+
+inline constexpr auto algorithm_names =
+    std::array<std::pair<std::string_view, Algorithm>, 9u>{ {
+        { "gift_wrapping", Algorithm::gift_wrapping },
+        { "graham_scan", Algorithm::graham_scan },
+        { "sweep_line", Algorithm::sweep_line },
+        { "delaunay", Algorithm::delaunay },
+        { "voronoi", Algorithm::voronoi },
+        { "voronoi_cells", Algorithm::voronoi_cells },
+        { "kd_tree", Algorithm::kd_tree },
+        { "euclidean_mst", Algorithm::euclidean_mst },
+        { "closest_pair", Algorithm::closest_pair },
+    } };
+
+[[nodiscard]] auto
+algorithm_name(Algorithm algorithm) noexcept -> std::string_view;
+
+struct Options
+{
+    std::filesystem::path input;
+    /**
+     * If not zero, this many points are generated instead of loading the
+     * input
+     */
+    std::size_t generate = 0u;
+    generator::Distribution distribution = generator::Distribution::uniform;
+    std::uint64_t seed = 0u;
+    /**
+     * Results are only timed, not written, if empty
+     */
+    std::filesystem::path output;
+    /**
+     * If not empty, the input is converted to a binary point set written
+     * here instead of running an algorithm
+     */
+    std::filesystem::path convert;
+    /**
+     * If not empty, the output of the algorithm is streamed to this mesh
+     * file (PLY if it has the .ply extension, indexed mesh otherwise)
+     * instead of being collected in memory
+     */
+    std::filesystem::path mesh;
+    /**
+     * If not empty, this recorded session is replayed instead of running an
+     * algorithm on the input
+     */
+    std::filesystem::path replay;
+    bool double_precision = false;
+    /**
+     * Converted coordinates are quantized to 16 bits over their bounding box
+     */
+    bool quantize = false;
+    Algorithm algorithm = Algorithm::delaunay;
+    std::size_t repeat = 1u;
+};
+
+/**
+ * Parses the command line. Returns std::nullopt if help was requested (and
+ * printed). Throws std::runtime_error on invalid arguments.
+ */
+[[nodiscard]] auto
+parse_options(int argc, char const* const* argv) -> std::optional<Options>;
+
+} // namespace pa093::cli
@@ -0,0 +1,173 @@
+#include <pa093/cli/replay.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+#include <variant>
+
+#include <pa093/scene/scene_builder.hpp>
+#include <pa093/scene/scene_editor.hpp>
+#include <pa093/scene/scene_geometry.hpp>
+#include <pa093/scene/scene_input.hpp>
+#include <pa093/scene/session.hpp>
+
+namespace pa093::cli
+{
+
+auto
+ReplayReport::total_ms() const -> double
+{
+    return std::accumulate(frames.begin(),
+                           frames.end(),
+                           0.0,
+                           [](double const sum, FrameTiming const& frame)
+                           { return sum + frame.recompute_ms; });
+}
+
+auto
+ReplayReport::total_edit_ms() const -> double
+{
+    return std::accumulate(frames.begin(),
+                           frames.end(),
+                           0.0,
+                           [](double const sum, FrameTiming const& frame)
+                           { return sum + frame.edit_ms; });
+}
+
+auto
+ReplayReport::percentile_ms(double const fraction) const -> double
+{
+    if (frames.empty())
+    {
+        return 0.0;
+    }
+
+    auto times = std::vector<double>(frames.size());
+    std::ranges::transform(frames, times.begin(), &FrameTiming::recompute_ms);
+
+    auto const rank = static_cast<std::size_t>(std::ceil(
+        std::clamp(fraction, 0.0, 1.0) * static_cast<double>(times.size())));
+    auto const nth =
+        times.begin() +
+        static_cast<std::ptrdiff_t>(std::max(rank, std::size_t{ 1 }) - 1u);
+    std::ranges::nth_element(times, nth);
+
+    return *nth;
+}
+
+auto
+ReplayReport::to_json() const -> nlohmann::json
+{
+    auto json_frames = nlohmann::json::array();
+    for (auto const& frame : frames)
+    {
+        json_frames.push_back({
+            { "frame", frame.frame },
+            { "events", frame.events },
+            { "points", frame.points },
+            { "edit_ms", frame.edit_ms },
+            { "recompute_ms", frame.recompute_ms },
+        });
+    }
+
+    return {
+        { "frames", std::move(json_frames) },
+        { "summary",
+          {
+              { "frames", frames.size() },
+              { "total_ms", total_ms() },
+              { "total_edit_ms", total_edit_ms() },
+              { "median_ms", percentile_ms(0.5) },
+              { "p95_ms", percentile_ms(0.95) },
+              { "max_ms", percentile_ms(1.0) },
+          } },
+    };
+}
+
+auto
+replay_session(std::filesystem::path const& path, std::size_t const repeat)
+    -> ReplayReport
+{
+    using clock_type = std::chrono::steady_clock;
+    using milliseconds = std::chrono::duration<double, std::milli>;
+
+    auto const events = scene::read_session(path);
+    auto report = ReplayReport{};
+
+    for (auto run = std::size_t{ 0 }; run < repeat; ++run)
+    {
+        auto editor = scene::SceneEditor{};
+        auto builder = scene::SceneBuilder{};
+        auto input = scene::SceneInput{};
+        auto geometry = scene::SceneGeometry{};
+        auto frame = std::size_t{ 0 };
+        auto frame_events = std::size_t{ 0 };
+        auto edit_time = milliseconds::zero();
+        auto timed_frames = std::size_t{ 0 };
+
+        auto const end_frame = [&]
+        {
+            auto start = clock_type::now();
+            if (editor.end_frame())
+            {
+                input.generation = frame + 1u;
+                editor.get_input(input);
+                edit_time += clock_type::now() - start;
+
+                start = clock_type::now();
+                builder(input, geometry, [] { return false; });
+                auto const time =
+                    milliseconds{ clock_type::now() - start }.count();
+
+                if (run == 0u)
+                {
+                    report.frames.push_back({
+                        .frame = frame,
+                        .events = frame_events,
+                        .points = input.points.size(),
+                        .edit_ms = edit_time.count(),
+                        .recompute_ms = time,
+                    });
+                }
+                else
+                {
+                    auto& timing = report.frames[timed_frames];
+                    timing.edit_ms =
+                        std::min(timing.edit_ms, edit_time.count());
+                    timing.recompute_ms = std::min(timing.recompute_ms, time);
+                }
+                ++timed_frames;
+            }
+
+            ++frame;
+            frame_events = 0u;
+            edit_time = milliseconds::zero();
+        };
+
+        for (auto const& event : events)
+        {
+            if (std::holds_alternative<scene::event::EndFrame>(event))
+            {
+                end_frame();
+            }
+            else
+            {
+                auto const start = clock_type::now();
+                editor.apply(event);
+                edit_time += clock_type::now() - start;
+                ++frame_events;
+            }
+        }
+
+        // A session cut short may lack the final frame marker
+        if (frame_events > 0u)
+        {
+            end_frame();
+        }
+    }
+
+    return report;
+}
+
+} // namespace pa093::cli
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+namespace pa093::cli
+{
+
+/**
+ * Scene recomputation after one recorded frame
+ */
+struct FrameTiming
+{
+    /** Index of the frame in the session */
+    std::size_t frame = 0u;
+    /** Number of edits made in the frame */
+    std::size_t events = 0u;
+    /** Number of points after the frame */
+    std::size_t points = 0u;
+    /**
+     * Fastest application of the frame's edits over all repetitions,
+     * including the preparation of the scene input
+     */
+    double edit_ms = 0.0;
+    /** Fastest recomputation of the frame over all repetitions */
+    double recompute_ms = 0.0;
+};
+
+struct ReplayReport
+{
+    std::vector<FrameTiming> frames;
+
+    [[nodiscard]] auto total_ms() const -> double;
+
+    [[nodiscard]] auto total_edit_ms() const -> double;
+
+    /**
+     * Recompute time below which the given fraction of frames falls
+     */
+    [[nodiscard]] auto percentile_ms(double fraction) const -> double;
+
+    [[nodiscard]] auto to_json() const -> nlohmann::json;
+};
+
+/**
+ * Replays a session recorded by the application without a window: applies
+ * the edits of every frame and then recomputes the scene synchronously,
+ * timing the edits and the recomputation separately. Only frames that
+ * recompute the scene are reported. The session is replayed repeat times and
+ * each frame reports its fastest run.
+ */
+[[nodiscard]] auto
+replay_session(std::filesystem::path const& path, std::size_t repeat)
+    -> ReplayReport;
+
+} // namespace pa093::cli
@@ -0,0 +1,239 @@
+#include <pa093/cli/runner.hpp>
+
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+
+#include <fmt/format.h>
+#include <spdlog/spdlog.h>
+
+namespace pa093::cli
+{
+
+auto
+Result::to_json() const -> nlohmann::json
+{
+    constexpr auto primitive_names = std::array{
+        "polygon",
+        "triangles",
+        "lines",
+        "polygons",
+    };
+
+    auto json = nlohmann::json{
+        { "primitive", primitive_names[static_cast<std::size_t>(primitive)] },
+        { "vertices", nlohmann::json::array() },
+    };
+
+    auto& json_vertices = json["vertices"];
+    for (auto const vertex : vertices)
+    {
+        json_vertices.push_back({ vertex.x, vertex.y });
+    }
+
+    if (primitive == Primitive::polygons)
+    {
+        json["offsets"] = offsets;
+    }
+
+    return json;
+}
+
+auto
+primitive(Algorithm const algorithm) noexcept -> Result::Primitive
+{
+    using Primitive = Result::Primitive;
+
+    switch (algorithm)
+    {
+        case Algorithm::gift_wrapping:
+        case Algorithm::graham_scan:
+            return Primitive::polygon;
+        case Algorithm::sweep_line:
+        case Algorithm::delaunay:
+            return Primitive::triangles;
+        case Algorithm::voronoi_cells:
+            return Primitive::polygons;
+        case Algorithm::voronoi:
+        case Algorithm::kd_tree:
+        case Algorithm::euclidean_mst:
+        case Algorithm::closest_pair:
+            return Primitive::lines;
+    }
+
+    return Primitive::lines;
+}
+
+Runner::Runner(std::span<glm::vec2 const> const points)
+    : points_{ points }
+    , bounds_{ padded_bounds(points) }
+{
+}
+
+void
+Runner::operator()(Algorithm const algorithm, Result& result)
+{
+    result.primitive = primitive(algorithm);
+    result.vertices.clear();
+    result.offsets.clear();
+
+    run(algorithm, std::back_inserter(result.vertices));
+
+    if (result.primitive == Result::Primitive::polygons)
+    {
+        std::ranges::copy(cells_.offsets(),
+                          std::back_inserter(result.offsets));
+    }
+}
+
+void
+Runner::operator()(Algorithm const algorithm, io::MeshWriter& mesh)
+{
+    using Primitive = Result::Primitive;
+
+    auto const vertices_per_face =
+        primitive(algorithm) == Primitive::triangles ? 3u : 2u;
+
+    if (primitive(algorithm) != Primitive::triangles and
+        primitive(algorithm) != Primitive::lines)
+    {
+        throw std::invalid_argument{ fmt::format(
+            "{} does not produce triangles or lines",
+            algorithm_name(algorithm)) };
+    }
+    if (mesh.vertices_per_face() != vertices_per_face)
+    {
+        throw std::invalid_argument{ "Mesh face size mismatch" };
+    }
+
+    run(algorithm, mesh.vertex_sink());
+}
+
+template<std::output_iterator<glm::vec2> O>
+void
+Runner::run(Algorithm const algorithm, O out)
+{
+    switch (algorithm)
+    {
+        case Algorithm::gift_wrapping:
+            gift_wrapping_(points_, out);
+            break;
+        case Algorithm::graham_scan:
+            graham_scan_(points_, out);
+            break;
+        case Algorithm::sweep_line:
+            sweep_line_(points_, out);
+            break;
+        case Algorithm::delaunay:
+            delaunay_(points_, out);
+            break;
+        case Algorithm::voronoi:
+            triangle_points_.clear();
+            delaunay_(points_, std::back_inserter(triangle_points_));
+            voronoi_(triangle_points_, out);
+            break;
+        case Algorithm::voronoi_cells:
+            triangulate();
+            voronoi_cells_(triangulation_, cells_);
+            std::ranges::copy(cells_.vertices(), out);
+            break;
+        case Algorithm::kd_tree:
+            build_kd_tree_(points_, kd_tree_);
+            add_kd_tree_splits(
+                kd_tree_.root(), 0u, bounds_.min, bounds_.max, out);
+            break;
+        case Algorithm::euclidean_mst:
+            triangulate();
+            edges_.clear();
+            euclidean_mst_(triangulation_, std::back_inserter(edges_));
+            add_edges(out);
+            break;
+        case Algorithm::closest_pair:
+            triangulate();
+            edges_.clear();
+            if (auto const pair = closest_pair_(triangulation_))
+            {
+                edges_.push_back(*pair);
+            }
+            add_edges(out);
+            break;
+    }
+}
+
+void
+Runner::triangulate()
+{
+    if (not indexed_delaunay_(points_, triangulation_))
+    {
+        spdlog::warn("Rounding left some points out of the triangulation");
+    }
+}
+
+auto
+Runner::padded_bounds(std::span<glm::vec2 const> const points) -> Bounds
+{
+    if (points.empty())
+    {
+        return { glm::vec2{ -1.0f }, glm::vec2{ 1.0f } };
+    }
+
+    constexpr auto inf = std::numeric_limits<float>::infinity();
+
+    auto min = glm::vec2{ inf, inf };
+    auto max = glm::vec2{ -inf, -inf };
+
+    for (auto const point : points)
+    {
+        min = glm::min(min, point);
+        max = glm::max(max, point);
+    }
+
+    auto const margin =
+        glm::max((max - min) * bounds_margin, glm::vec2{ min_bounds_margin });
+
+    return { min - margin, max + margin };
+}
+
+template<std::output_iterator<glm::vec2> O>
+auto
+Runner::add_kd_tree_splits(datastructure::KDTree2f::node_id_type const node_id,
+                           std::size_t const depth,
+                           glm::vec2 const min,
+                           glm::vec2 const max,
+                           O out) const -> O
+{
+    if (not node_id or kd_tree_.is_leaf(node_id))
+    {
+        return out;
+    }
+
+    auto const& node = kd_tree_.node(node_id);
+    auto const current_dim = static_cast<int>(depth % 2u);
+
+    // Dividing line
+    auto line_start = min;
+    line_start[current_dim] = node.pivot;
+    auto line_end = max;
+    line_end[current_dim] = node.pivot;
+
+    *out++ = line_start;
+    *out++ = line_end;
+
+    out = add_kd_tree_splits(node.left, depth + 1u, min, line_end, out);
+    return add_kd_tree_splits(node.right, depth + 1u, line_start, max, out);
+}
+
+template<std::output_iterator<glm::vec2> O>
+auto
+Runner::add_edges(O out) const -> O
+{
+    for (auto const [a, b] : edges_)
+    {
+        *out++ = triangulation_.point(a);
+        *out++ = triangulation_.point(b);
+    }
+
+    return out;
+}
+
+} // namespace pa093::cli
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <nlohmann/json.hpp>
+
+#include <pa093/algorithm/convex_hull/gift_wrapping.hpp>
+#include <pa093/algorithm/convex_hull/graham_scan.hpp>
+#include <pa093/algorithm/graph/closest_pair.hpp>
+#include <pa093/algorithm/graph/euclidean_mst.hpp>
+#include <pa093/algorithm/kd_tree/build_kd_tree.hpp>
+#include <pa093/algorithm/triangulation/delaunay.hpp>
+#include <pa093/algorithm/triangulation/dual_graph.hpp>
+#include <pa093/algorithm/triangulation/indexed_delaunay.hpp>
+#include <pa093/algorithm/triangulation/sweep_line.hpp>
+#include <pa093/algorithm/triangulation/voronoi_cells.hpp>
+#include <pa093/cli/options.hpp>
+#include <pa093/datastructure/kd_tree.hpp>
+#include <pa093/datastructure/polygon_set.hpp>
+#include <pa093/datastructure/triangulation.hpp>
+#include <pa093/io/mesh_writer.hpp>
+
+namespace pa093::cli
+{
+
+/**
+ * Geometry produced by an algorithm, in the form it is written out
+ */
+struct Result
+{
+    enum class Primitive
+    {
+        /** A single closed polygon */
+        polygon,
+        /** Every three vertices form a triangle */
+        triangles,
+        /** Every two vertices form a line segment */
+        lines,
+        /** Polygons delimited by offsets */
+        polygons,
+    };
+
+    Primitive primitive = Primitive::polygon;
+    std::vector<glm::vec2> vertices;
+    std::vector<std::size_t> offsets;
+
+    [[nodiscard]] auto to_json() const -> nlohmann::json;
+};
+
+/**
+ * Kind of geometry an algorithm produces
+ */
+[[nodiscard]] auto
+primitive(Algorithm algorithm) noexcept -> Result::Primitive;
+
+/**
+ * Runs algorithms on the points of one input file, keeping the algorithm
+ * instances (and their scratch memory) between repeated runs.
+ *
+ * Bounded outputs (Voronoi cells, hull edges of the dual graph) are sized
+ * to the bounding box of the points.
+ */
+class Runner
+{
+public:
+    /** Margin around the bounding box of the points, relative to its size */
+    static constexpr auto bounds_margin = 0.1f;
+    static constexpr auto min_bounds_margin = 1e-3f;
+
+    [[nodiscard]] explicit Runner(std::span<glm::vec2 const> points);
+
+    /**
+     * Runs the algorithm on the points, replacing the contents of result.
+     * The sweep line triangulation treats the points as the vertices of a
+     * polygon in file order.
+     */
+    void operator()(Algorithm algorithm, Result& result);
+
+    /**
+     * Runs an algorithm producing triangles or lines, streaming its output
+     * to the mesh as it is generated. Throws std::invalid_argument for other
+     * algorithms or if the mesh face size does not match.
+     */
+    void operator()(Algorithm algorithm, io::MeshWriter& mesh);
+
+private:
+    struct Bounds
+    {
+        glm::vec2 min;
+        glm::vec2 max;
+    };
+
+    std::span<glm::vec2 const> points_;
+    Bounds bounds_;
+
+    // Algorithms
+    algorithm::convex_hull::GiftWrapping gift_wrapping_;
+    algorithm::convex_hull::GrahamScan graham_scan_;
+    algorithm::kd_tree::BuildKDTree2f build_kd_tree_;
+    algorithm::triangulation::SweepLine sweep_line_;
+    algorithm::triangulation::Delaunay delaunay_;
+    algorithm::triangulation::DualGraph voronoi_{ 1.5f * glm::distance(
+        bounds_.min, bounds_.max) };
+    algorithm::triangulation::IndexedDelaunay indexed_delaunay_;
+    algorithm::triangulation::VoronoiCells voronoi_cells_{ bounds_.min,
+                                                           bounds_.max };
+    algorithm::graph::EuclideanMST euclidean_mst_;
+    algorithm::graph::ClosestPair closest_pair_;
+
+    // Datastructures
+    datastructure::Triangulation triangulation_;
+    datastructure::PolygonSet cells_;
+    datastructure::KDTree2f kd_tree_;
+    std::vector<glm::vec2> triangle_points_;
+    std::vector<datastructure::Triangulation::edge_type> edges_;
+
+    [[nodiscard]] static auto padded_bounds(std::span<glm::vec2 const> points)
+        -> Bounds;
+
+    /**
+     * Indexed Delaunay triangulation of the points, warning if rounding left
+     * some of them out
+     */
+    void triangulate();
+
+    template<std::output_iterator<glm::vec2> O>
+    void run(Algorithm algorithm, O out);
+
+    template<std::output_iterator<glm::vec2> O>
+    auto add_kd_tree_splits(datastructure::KDTree2f::node_id_type node_id,
+                            std::size_t depth,
+                            glm::vec2 min,
+                            glm::vec2 max,
+                            O out) const -> O;
+
+    template<std::output_iterator<glm::vec2> O>
+    auto add_edges(O out) const -> O;
+};
+
+} // namespace pa093::cli
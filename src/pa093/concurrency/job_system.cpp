@@ -0,0 +1,288 @@
+#include <pa093/concurrency/job_system.hpp>
+
+#include <algorithm>
+#include <array>
+
+namespace pa093::concurrency
+{
+
+namespace
+{
+
+/**
+ * Failed attempts to find a job before a waiting thread blocks
+ */
+constexpr auto max_idle_spins = 64;
+
+struct WorkerIdentity
+{
+    JobSystem const* system = nullptr;
+    std::size_t index = 0u;
+};
+
+thread_local auto current_worker_identity = WorkerIdentity{};
+
+} // namespace
+
+/**
+ * Bounded double-ended queue; a mutex is plenty for jobs of the size of a
+ * parallel_for chunk
+ */
+class JobSystem::JobQueue
+{
+public:
+    auto push(Job const& job) -> bool
+    {
+        auto const lock = std::scoped_lock{ mutex_ };
+        if (size_ == jobs_.size())
+        {
+            return false;
+        }
+
+        jobs_[(head_ + size_) % jobs_.size()] = job;
+        ++size_;
+        return true;
+    }
+
+    /**
+     * Takes the newest job; used by the owner
+     */
+    auto pop() -> std::optional<Job>
+    {
+        auto const lock = std::scoped_lock{ mutex_ };
+        if (size_ == 0u)
+        {
+            return std::nullopt;
+        }
+
+        --size_;
+        return jobs_[(head_ + size_) % jobs_.size()];
+    }
+
+    /**
+     * Takes the oldest job; used by the other threads
+     */
+    auto steal() -> std::optional<Job>
+    {
+        auto const lock = std::scoped_lock{ mutex_ };
+        if (size_ == 0u)
+        {
+            return std::nullopt;
+        }
+
+        auto const job = jobs_[head_];
+        head_ = (head_ + 1u) % jobs_.size();
+        --size_;
+        return job;
+    }
+
+private:
+    std::mutex mutex_;
+    std::array<Job, queue_capacity> jobs_ = {};
+    std::size_t head_ = 0u;
+    std::size_t size_ = 0u;
+};
+
+auto
+hardware_thread_count() noexcept -> std::size_t
+{
+    return std::max(std::size_t{ 1 },
+                    static_cast<std::size_t>(
+                        std::thread::hardware_concurrency()));
+}
+
+JobSystem::JobSystem(std::size_t const thread_count)
+    : shared_queue_{ std::make_unique<JobQueue>() }
+{
+    auto const num_workers =
+        std::max(thread_count, hardware_thread_count()) - 1u;
+
+    queues_.reserve(num_workers);
+    for (auto i = std::size_t{ 0 }; i < num_workers; ++i)
+    {
+        queues_.push_back(std::make_unique<JobQueue>());
+    }
+
+    set_thread_count(thread_count);
+
+    workers_.reserve(num_workers);
+    for (auto i = std::size_t{ 0 }; i < num_workers; ++i)
+    {
+        workers_.emplace_back([this, i](std::stop_token const& stop)
+                              { run_worker(stop, i); });
+    }
+}
+
+JobSystem::~JobSystem()
+{
+    for (auto& worker : workers_)
+    {
+        worker.request_stop();
+    }
+
+    work_epoch_.fetch_add(1u, std::memory_order_release);
+    work_epoch_.notify_all();
+
+    workers_.clear();
+}
+
+auto
+JobSystem::instance() -> JobSystem&
+{
+    static auto jobs = JobSystem{};
+    return jobs;
+}
+
+void
+JobSystem::set_thread_count(std::size_t const count) noexcept
+{
+    auto const clamped =
+        std::clamp(count, std::size_t{ 1 }, max_thread_count());
+    active_workers_.store(clamped - 1u, std::memory_order_relaxed);
+
+    // Let newly activated workers look for jobs
+    work_epoch_.fetch_add(1u, std::memory_order_release);
+    work_epoch_.notify_all();
+}
+
+auto
+JobSystem::current_worker() const noexcept -> std::optional<std::size_t>
+{
+    if (current_worker_identity.system != this)
+    {
+        return std::nullopt;
+    }
+
+    return current_worker_identity.index;
+}
+
+void
+JobSystem::submit(Job const& job)
+{
+    auto const worker = current_worker();
+    auto& queue = worker ? *queues_[*worker] : *shared_queue_;
+
+    if (not queue.push(job))
+    {
+        execute(job);
+    }
+}
+
+void
+JobSystem::wake_workers(std::size_t const num_jobs) noexcept
+{
+    if (num_jobs == 0u or queues_.empty())
+    {
+        return;
+    }
+
+    work_epoch_.fetch_add(1u, std::memory_order_release);
+    if (num_jobs == 1u)
+    {
+        work_epoch_.notify_one();
+    }
+    else
+    {
+        work_epoch_.notify_all();
+    }
+}
+
+void
+JobSystem::execute(Job const& job) noexcept
+{
+    auto& group = *job.group;
+
+    try
+    {
+        job.run(job.context, job.index);
+    }
+    catch (...)
+    {
+        auto const lock = std::scoped_lock{ group.mutex };
+        if (not group.error)
+        {
+            group.error = std::current_exception();
+        }
+    }
+
+    if (group.pending.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+    {
+        // Notified under the lock: the waiter may destroy the group as soon
+        // as it can take the lock
+        auto const lock = std::scoped_lock{ group.mutex };
+        group.finished = true;
+        group.finished_condition.notify_all();
+    }
+}
+
+auto
+JobSystem::run_queued_job(std::optional<std::size_t> const worker) -> bool
+{
+    auto job = worker ? queues_[*worker]->pop() : std::nullopt;
+
+    if (not job)
+    {
+        job = shared_queue_->steal();
+    }
+
+    // Steal round robin, starting after the own queue
+    auto const first = worker ? *worker + 1u : 0u;
+    for (auto i = std::size_t{ 0 }; not job and i < queues_.size(); ++i)
+    {
+        job = queues_[(first + i) % queues_.size()]->steal();
+    }
+
+    if (not job)
+    {
+        return false;
+    }
+
+    execute(*job);
+    return true;
+}
+
+void
+JobSystem::wait(JobGroup& group)
+{
+    auto const worker = current_worker();
+    auto idle_spins = 0;
+
+    while (group.pending.load(std::memory_order_acquire) > 0u and
+           idle_spins < max_idle_spins)
+    {
+        if (run_queued_job(worker))
+        {
+            idle_spins = 0;
+        }
+        else
+        {
+            ++idle_spins;
+            std::this_thread::yield();
+        }
+    }
+
+    // The remaining jobs are running on other threads
+    auto lock = std::unique_lock{ group.mutex };
+    group.finished_condition.wait(lock, [&] { return group.finished; });
+}
+
+void
+JobSystem::run_worker(std::stop_token const& stop, std::size_t const index)
+{
+    current_worker_identity = { this, index };
+
+    while (not stop.stop_requested())
+    {
+        auto const epoch = work_epoch_.load(std::memory_order_acquire);
+
+        if (index < active_workers_.load(std::memory_order_relaxed) and
+            run_queued_job(index))
+        {
+            continue;
+        }
+
+        work_epoch_.wait(epoch, std::memory_order_acquire);
+    }
+}
+
+} // namespace pa093::concurrency
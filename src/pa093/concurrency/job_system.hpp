@@ -0,0 +1,190 @@
+#pragma once
+
+#include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace pa093::concurrency
+{
+
+[[nodiscard]] auto hardware_thread_count() noexcept -> std::size_t;
+
+/**
+ * Work-stealing scheduler for fork/join parallelism.
+ *
+ * Every worker thread owns a queue: it pushes and pops its jobs at the back,
+ * while idle workers steal from the front of the other queues. Threads that
+ * are not workers push to a shared queue. A thread waiting for forked jobs
+ * runs queued jobs in the meantime, so jobs can fork and join jobs of their
+ * own without exhausting the workers.
+ *
+ * The thread count includes the thread that forks, so with a thread count
+ * of one, all jobs run on the calling thread.
+ */
+class JobSystem
+{
+public:
+    /**
+     * Jobs a single queue holds; a job forked onto a full queue runs
+     * immediately on the forking thread
+     */
+    static constexpr auto queue_capacity = std::size_t{ 1024 };
+
+    [[nodiscard]] explicit JobSystem(
+        std::size_t thread_count = hardware_thread_count());
+
+    ~JobSystem();
+
+    JobSystem(JobSystem const&) = delete;
+    auto operator=(JobSystem const&) -> JobSystem& = delete;
+
+    /**
+     * The job system used by everything that is not given another one
+     */
+    [[nodiscard]] static auto instance() -> JobSystem&;
+
+    [[nodiscard]] auto thread_count() const noexcept -> std::size_t
+    {
+        return active_workers_.load(std::memory_order_relaxed) + 1u;
+    }
+
+    /**
+     * Upper bound of the thread count, fixed at construction
+     */
+    [[nodiscard]] auto max_thread_count() const noexcept -> std::size_t
+    {
+        return queues_.size() + 1u;
+    }
+
+    /**
+     * Sets the number of threads running jobs, clamped to
+     * [1, max_thread_count()]. May be called while jobs are running; workers
+     * above the new count go idle once they finish their current job.
+     */
+    void set_thread_count(std::size_t count) noexcept;
+
+    /**
+     * Calls f(i) for every i in [0, count) as separate jobs and returns once
+     * all of them finished. The calling thread runs f(0) itself. If any call
+     * throws, the first exception is rethrown after all calls finished.
+     */
+    template<std::invocable<std::size_t> F>
+    void fork_join(std::size_t const count, F&& f)
+    {
+        if (count == 0u)
+        {
+            return;
+        }
+
+        auto group = JobGroup{};
+        group.pending.store(count, std::memory_order_relaxed);
+
+        auto* const context =
+            const_cast<void*>(static_cast<void const*>(std::addressof(f)));
+        auto const run = [](void* const context, std::size_t const index)
+        {
+            std::invoke(*static_cast<std::remove_reference_t<F>*>(context),
+                        index);
+        };
+
+        for (auto index = std::size_t{ 1 }; index < count; ++index)
+        {
+            submit({ run, context, index, &group });
+        }
+        wake_workers(count - 1u);
+
+        execute({ run, context, 0u, &group });
+        wait(group);
+
+        if (group.error)
+        {
+            std::rethrow_exception(group.error);
+        }
+    }
+
+private:
+    struct JobGroup
+    {
+        std::atomic<std::size_t> pending = 0u;
+        std::mutex mutex;
+        std::condition_variable finished_condition;
+        bool finished = false;
+        std::exception_ptr error;
+    };
+
+    struct Job
+    {
+        void (*run)(void*, std::size_t) = nullptr;
+        void* context = nullptr;
+        std::size_t index = 0u;
+        JobGroup* group = nullptr;
+    };
+
+    class JobQueue;
+
+    std::vector<std::unique_ptr<JobQueue>> queues_;
+    std::unique_ptr<JobQueue> shared_queue_;
+    std::atomic<std::size_t> active_workers_ = 0u;
+    std::atomic<std::uint64_t> work_epoch_ = 0u;
+    // Declared last, so that the threads stop before the queues are
+    // destroyed
+    std::vector<std::jthread> workers_;
+
+    /**
+     * Index of the calling thread if it is one of the workers
+     */
+    [[nodiscard]] auto current_worker() const noexcept
+        -> std::optional<std::size_t>;
+
+    void submit(Job const& job);
+
+    void wake_workers(std::size_t num_jobs) noexcept;
+
+    static void execute(Job const& job) noexcept;
+
+    /**
+     * Runs one queued job, preferring the caller's own queue; returns false
+     * if all queues were empty
+     */
+    auto run_queued_job(std::optional<std::size_t> worker) -> bool;
+
+    void wait(JobGroup& group);
+
+    void run_worker(std::stop_token const& stop, std::size_t index);
+};
+
+/**
+ * Calls all functions concurrently, returning once all of them returned
+ */
+template<std::invocable... Fs>
+void
+parallel_invoke(JobSystem& jobs, Fs&&... fs)
+{
+    jobs.fork_join(sizeof...(Fs),
+                   [&](std::size_t const index)
+                   {
+                       auto i = std::size_t{ 0 };
+                       (
+                           [&]
+                           {
+                               if (i++ == index)
+                               {
+                                   std::invoke(fs);
+                               }
+                           }(),
+                           ...);
+                   });
+}
+
+} // namespace pa093::concurrency
@@ -0,0 +1 @@
+#include <pa093/concurrency/parallel_for.hpp>
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+
+#include <pa093/concurrency/job_system.hpp>
+
+namespace pa093::concurrency
+{
+
+/**
+ * Upper bound on the number of chunks parallel_for_chunks may use with the
+ * job system. It does not change with the thread count, so per-chunk state
+ * can be preallocated once.
+ */
+[[nodiscard]] inline auto
+max_chunk_count(JobSystem const& jobs = JobSystem::instance()) noexcept
+    -> std::size_t
+{
+    return jobs.max_thread_count();
+}
+
+/**
+ * Splits [0, count) into at most max_chunk_count(jobs) contiguous chunks (but
+ * no chunk smaller than min_chunk_size) and calls
+ * f(chunk_index, chunk_begin, chunk_end) for each chunk as a job.
+ *
+ * Returns the number of chunks used; chunk indices are dense in
+ * [0, returned value), which allows callers to preallocate per-chunk state
+ * with max_chunk_count().
+ */
+template<std::invocable<std::size_t, std::size_t, std::size_t> F>
+auto
+parallel_for_chunks(JobSystem& jobs,
+                    std::size_t const count,
+                    F&& f,
+                    std::size_t const min_chunk_size = 1024u) -> std::size_t
+{
+    if (count == 0u)
+    {
+        return 0u;
+    }
+
+    auto const num_chunks = std::clamp(
+        count / std::max(min_chunk_size, std::size_t{ 1 }),
+        std::size_t{ 1 },
+        max_chunk_count(jobs));
+    auto const chunk_begin = [=](std::size_t const chunk)
+    { return count * chunk / num_chunks; };
+
+    if (num_chunks == 1u)
+    {
+        std::invoke(f, std::size_t{ 0 }, std::size_t{ 0 }, count);
+        return 1u;
+    }
+
+    jobs.fork_join(num_chunks,
+                   [&](std::size_t const chunk)
+                   {
+                       std::invoke(f,
+                                   chunk,
+                                   chunk_begin(chunk),
+                                   chunk_begin(chunk + 1u));
+                   });
+
+    return num_chunks;
+}
+
+template<std::invocable<std::size_t, std::size_t, std::size_t> F>
+auto
+parallel_for_chunks(std::size_t const count,
+                    F&& f,
+                    std::size_t const min_chunk_size = 1024u) -> std::size_t
+{
+    return parallel_for_chunks(
+        JobSystem::instance(), count, std::forward<F>(f), min_chunk_size);
+}
+
+/**
+ * Calls f(i) for every i in [0, count), distributing the indices over the
+ * job system in contiguous chunks.
+ */
+template<std::invocable<std::size_t> F>
+void
+parallel_for(JobSystem& jobs,
+             std::size_t const count,
+             F&& f,
+             std::size_t const min_chunk_size = 1024u)
+{
+    parallel_for_chunks(
+        jobs,
+        count,
+        [&](std::size_t, std::size_t const begin, std::size_t const end)
+        {
+            for (auto i = begin; i < end; ++i)
+            {
+                std::invoke(f, i);
+            }
+        },
+        min_chunk_size);
+}
+
+template<std::invocable<std::size_t> F>
+void
+parallel_for(std::size_t const count,
+             F&& f,
+             std::size_t const min_chunk_size = 1024u)
+{
+    parallel_for(
+        JobSystem::instance(), count, std::forward<F>(f), min_chunk_size);
+}
+
+} // namespace pa093::concurrency
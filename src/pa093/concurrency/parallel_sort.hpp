@@ -0,0 +1,102 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+
+#include <pa093/concurrency/job_system.hpp>
+
+namespace pa093::concurrency
+{
+
+/**
+ * Ranges no longer than this are sorted sequentially
+ */
+inline constexpr auto parallel_sort_cutoff = std::size_t{ 4096 };
+
+namespace detail
+{
+
+template<std::random_access_iterator I, typename Comp, typename Proj>
+void
+parallel_sort(JobSystem& jobs,
+              I const first,
+              I const last,
+              Comp& comp,
+              Proj& proj,
+              std::size_t const depth)
+{
+    auto const size = static_cast<std::size_t>(last - first);
+    if (size <= parallel_sort_cutoff or depth == 0u)
+    {
+        std::ranges::sort(first, last, comp, proj);
+        return;
+    }
+
+    auto const less = [&](auto const& a, auto const& b)
+    { return std::invoke(comp, std::invoke(proj, a), std::invoke(proj, b)); };
+
+    // Median of three; copied, as partitioning moves the elements
+    auto a = *first;
+    auto b = *(first + static_cast<std::ptrdiff_t>(size / 2u));
+    auto c = *(last - 1);
+    if (less(b, a))
+    {
+        std::ranges::swap(a, b);
+    }
+    if (less(c, b))
+    {
+        std::ranges::swap(b, c);
+        if (less(b, a))
+        {
+            std::ranges::swap(a, b);
+        }
+    }
+    auto const& pivot = b;
+
+    // Three-way partition, so that runs of equal elements end the recursion
+    auto const lower_end =
+        std::ranges::partition(
+            first, last, [&](auto const& x) { return less(x, pivot); })
+            .begin();
+    auto const upper_begin =
+        std::ranges::partition(
+            lower_end, last, [&](auto const& x) { return not less(pivot, x); })
+            .begin();
+
+    parallel_invoke(
+        jobs,
+        [&] { parallel_sort(jobs, first, lower_end, comp, proj, depth - 1u); },
+        [&]
+        { parallel_sort(jobs, upper_begin, last, comp, proj, depth - 1u); });
+}
+
+} // namespace detail
+
+/**
+ * Sorts the range like std::ranges::sort, as a parallel quicksort on the job
+ * system. Not stable. Comparison and projection are called concurrently.
+ */
+template<std::ranges::random_access_range R,
+         typename Comp = std::ranges::less,
+         typename Proj = std::identity>
+requires std::sortable<std::ranges::iterator_t<R>, Comp, Proj>
+void
+parallel_sort(JobSystem& jobs, R&& range, Comp comp = {}, Proj proj = {})
+{
+    auto const size = static_cast<std::size_t>(std::ranges::distance(range));
+
+    // Past twice the ideal depth, the pivots are bad; finish sequentially
+    detail::parallel_sort(jobs,
+                          std::ranges::begin(range),
+                          std::ranges::begin(range) +
+                              static_cast<std::ptrdiff_t>(size),
+                          comp,
+                          proj,
+                          2u * static_cast<std::size_t>(std::bit_width(size)));
+}
+
+} // namespace pa093::concurrency
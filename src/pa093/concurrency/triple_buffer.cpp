@@ -0,0 +1 @@
+#include <pa093/concurrency/triple_buffer.hpp>
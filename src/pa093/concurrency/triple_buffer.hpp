@@ -0,0 +1,84 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstdint>
+
+namespace pa093::concurrency
+{
+
+/**
+ * Lock-free single producer, single consumer handoff of the latest value.
+ *
+ * The producer fills back() and publishes it; the consumer acquires the most
+ * recently published buffer as front(). Neither side ever waits, and values
+ * published before the consumer got to them are overwritten.
+ */
+template<std::default_initializable T>
+class TripleBuffer
+{
+public:
+    /**
+     * Buffer owned by the producer
+     */
+    [[nodiscard]] auto back() noexcept -> T& { return buffers_[back_]; }
+
+    /**
+     * Buffer owned by the consumer
+     */
+    [[nodiscard]] auto front() noexcept -> T& { return buffers_[front_]; }
+
+    [[nodiscard]] auto front() const noexcept -> T const&
+    {
+        return buffers_[front_];
+    }
+
+    /**
+     * Producer: hands the back buffer over, taking a free one in its place.
+     */
+    void publish() noexcept
+    {
+        auto const published = static_cast<std::uint8_t>(back_ | updated_flag);
+        back_ = static_cast<std::uint8_t>(
+            state_.exchange(published, std::memory_order_acq_rel) & index_mask);
+    }
+
+    /**
+     * Whether a buffer was published since the consumer last acquired one
+     */
+    [[nodiscard]] auto updated() const noexcept -> bool
+    {
+        return state_.load(std::memory_order_acquire) & updated_flag;
+    }
+
+    /**
+     * Consumer: makes the latest published buffer the front buffer. Returns
+     * false (keeping the front buffer) if nothing new was published.
+     */
+    auto acquire() noexcept -> bool
+    {
+        if (not updated())
+        {
+            return false;
+        }
+
+        front_ = static_cast<std::uint8_t>(
+            state_.exchange(front_, std::memory_order_acq_rel) & index_mask);
+        return true;
+    }
+
+private:
+    static constexpr auto index_mask = std::uint8_t{ 0b011 };
+    static constexpr auto updated_flag = std::uint8_t{ 0b100 };
+
+    std::array<T, 3u> buffers_ = {};
+    std::uint8_t back_ = 0u;
+    std::uint8_t front_ = 1u;
+    /**
+     * Index of the buffer in transit, plus the updated flag
+     */
+    std::atomic<std::uint8_t> state_ = 2u;
+};
+
+} // namespace pa093::concurrency
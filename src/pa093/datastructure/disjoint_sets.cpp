@@ -0,0 +1,55 @@
+#include <pa093/datastructure/disjoint_sets.hpp>
+
+#include <numeric>
+#include <utility>
+
+namespace pa093::datastructure
+{
+
+void
+DisjointSets::assign(std::size_t const count)
+{
+    parents_.resize(count);
+    std::iota(parents_.begin(), parents_.end(), index_type{ 0 });
+    sizes_.assign(count, 1u);
+    num_sets_ = count;
+}
+
+auto
+DisjointSets::find(index_type i) noexcept -> index_type
+{
+    Expects(i < parents_.size());
+
+    while (parents_[i] != i)
+    {
+        parents_[i] = parents_[parents_[i]];
+        i = parents_[i];
+    }
+
+    return i;
+}
+
+auto
+DisjointSets::unite(index_type a, index_type b) noexcept -> bool
+{
+    a = find(a);
+    b = find(b);
+
+    if (a == b)
+    {
+        return false;
+    }
+
+    if (sizes_[a] < sizes_[b])
+    {
+        std::swap(a, b);
+    }
+
+    parents_[b] = a;
+    sizes_[a] += sizes_[b];
+    --num_sets_;
+
+    return true;
+}
+
+} // namespace pa093::datastructure
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include <gsl/gsl_assert>
+
+namespace pa093::datastructure
+{
+
+/**
+ * Union-find over the elements 0..size-1, with union by size and path
+ * halving.
+ */
+class DisjointSets
+{
+public:
+    using index_type = std::uint32_t;
+
+    [[nodiscard]] explicit DisjointSets(
+        std::pmr::memory_resource* const resource =
+            std::pmr::get_default_resource()) noexcept
+        : parents_{ resource }
+        , sizes_{ resource }
+    {
+    }
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t
+    {
+        return parents_.size();
+    }
+
+    [[nodiscard]] auto num_sets() const noexcept -> std::size_t
+    {
+        return num_sets_;
+    }
+
+    /**
+     * Resets to the given number of singleton sets.
+     */
+    void assign(std::size_t count);
+
+    /**
+     * Representative of the set containing i
+     */
+    [[nodiscard]] auto find(index_type i) noexcept -> index_type;
+
+    /**
+     * Merges the sets containing a and b; returns false if they were already
+     * the same set.
+     */
+    auto unite(index_type a, index_type b) noexcept -> bool;
+
+    void clear()
+    {
+        parents_.clear();
+        sizes_.clear();
+        num_sets_ = 0u;
+    }
+
+private:
+    std::pmr::vector<index_type> parents_;
+    std::pmr::vector<index_type> sizes_;
+    std::size_t num_sets_ = 0u;
+};
+
+} // namespace pa093::datastructure
@@ -4,6 +4,7 @@
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include <memory_resource>
 #include <ranges>
 #include <vector>
 
@@ -23,6 +24,15 @@ public:
 
     static constexpr auto dim = dim_;
 
+    KDTree() = default;
+
+    [[nodiscard]] explicit KDTree(
+        std::pmr::memory_resource* const resource) noexcept
+        : nodes_{ resource }
+        , leaves_{ resource }
+    {
+    }
+
     struct node_type
     {
         static constexpr auto null = node_id_type{};
@@ -51,10 +61,19 @@ public:
         return nodes_[id - 1u];
     }
 
-    [[nodiscard]] auto leaf(node_id_type const id) const noexcept -> point_type
+    /**
+     * Position of a leaf in points()
+     */
+    [[nodiscard]] static auto leaf_index(node_id_type const id) noexcept
+        -> std::size_t
     {
         Expects(is_leaf(id));
-        return &leaves_[id & ~node_type::leaf_mask];
+        return static_cast<std::size_t>(id & ~node_type::leaf_mask);
+    }
+
+    [[nodiscard]] auto leaf(node_id_type const id) const noexcept -> point_type
+    {
+        return leaves_[leaf_index(id)];
     }
 
     [[nodiscard]] auto root() const noexcept -> node_id_type
@@ -99,8 +118,8 @@ public:
     }
 
 private:
-    std::vector<node_type> nodes_;
-    std::vector<point_type> leaves_;
+    std::pmr::vector<node_type> nodes_;
+    std::pmr::vector<point_type> leaves_;
 };
 
 using KDTree2f = KDTree<float, 2u>;
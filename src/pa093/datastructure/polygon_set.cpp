@@ -0,0 +1 @@
+#include <pa093/datastructure/polygon_set.hpp>
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <gsl/gsl_assert>
+
+namespace pa093::datastructure
+{
+
+/**
+ * A sequence of polygons stored in a single flat vertex buffer; polygon i
+ * spans vertices [offsets[i], offsets[i + 1]).
+ */
+class PolygonSet
+{
+public:
+    using point_type = glm::vec2;
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t
+    {
+        return offsets_.size() - 1u;
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool { return size() == 0u; }
+
+    [[nodiscard]] auto polygon(std::size_t const i) const noexcept
+        -> std::span<point_type const>
+    {
+        Expects(i < size());
+        return std::span{ vertices_ }.subspan(offsets_[i],
+                                              offsets_[i + 1u] - offsets_[i]);
+    }
+
+    [[nodiscard]] auto polygon(std::size_t const i) noexcept
+        -> std::span<point_type>
+    {
+        Expects(i < size());
+        return std::span{ vertices_ }.subspan(offsets_[i],
+                                              offsets_[i + 1u] - offsets_[i]);
+    }
+
+    [[nodiscard]] auto vertices() const noexcept
+        -> std::span<point_type const>
+    {
+        return vertices_;
+    }
+
+    [[nodiscard]] auto vertices() noexcept -> std::span<point_type>
+    {
+        return vertices_;
+    }
+
+    [[nodiscard]] auto offsets() const noexcept
+        -> std::span<std::size_t const>
+    {
+        return offsets_;
+    }
+
+    void clear()
+    {
+        offsets_.assign(1u, 0u);
+        vertices_.clear();
+    }
+
+    template<std::ranges::input_range R>
+    requires std::same_as<std::ranges::range_value_t<R>, point_type>
+    void add_polygon(R&& polygon)
+    {
+        std::ranges::copy(polygon, std::back_inserter(vertices_));
+        offsets_.push_back(vertices_.size());
+    }
+
+    /**
+     * Replaces the contents with polygons of the given sizes and
+     * unspecified vertices, to be filled in through polygon(i).
+     */
+    void set_layout(std::span<std::size_t const> const polygon_sizes)
+    {
+        offsets_.resize(polygon_sizes.size() + 1u);
+        offsets_[0] = 0u;
+        std::inclusive_scan(polygon_sizes.begin(),
+                            polygon_sizes.end(),
+                            std::next(offsets_.begin()));
+        vertices_.resize(offsets_.back());
+    }
+
+private:
+    std::vector<std::size_t> offsets_ = { 0u };
+    std::vector<point_type> vertices_;
+};
+
+} // namespace pa093::datastructure
@@ -0,0 +1,202 @@
+#include <pa093/datastructure/quantization.hpp>
+
+#include <algorithm>
+#include <cstddef>
+
+#include <gsl/gsl_assert>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace pa093::datastructure
+{
+
+namespace
+{
+
+static_assert(sizeof(glm::vec2) == 2u * sizeof(float));
+static_assert(sizeof(glm::u16vec2) == 2u * sizeof(std::uint16_t));
+
+/**
+ * Quantizes values whose even elements are x and odd elements y coordinates,
+ * scaling them by scale after subtracting min
+ */
+void
+quantize_interleaved(float const* const values,
+                     std::size_t const count,
+                     glm::vec2 const min,
+                     glm::vec2 const scale,
+                     std::uint16_t* const quantized)
+{
+    auto i = std::size_t{ 0 };
+
+#if defined(__SSE2__)
+    // Four points per iteration. The conversion truncates, so adding a half
+    // rounds to nearest, like the scalar loop. Packing saturates to signed
+    // 16 bits; the values are biased to fit, and flipping the sign bit of
+    // the packed values removes the bias again.
+    auto const min4 = _mm_setr_ps(min.x, min.y, min.x, min.y);
+    auto const scale4 = _mm_setr_ps(scale.x, scale.y, scale.x, scale.y);
+    auto const zero = _mm_setzero_ps();
+    auto const max_value = _mm_set1_ps(Quantization::max_value);
+    auto const half = _mm_set1_ps(0.5f);
+    auto const bias = _mm_set1_epi32(32768);
+    auto const sign_bit = _mm_set1_epi16(static_cast<short>(0x8000));
+
+    auto const to_biased_int = [&](__m128 const v)
+    {
+        auto const scaled = _mm_mul_ps(_mm_sub_ps(v, min4), scale4);
+        // The maximum comes first, so that NaN becomes 0
+        auto const clamped =
+            _mm_min_ps(_mm_max_ps(scaled, zero), max_value);
+        return _mm_sub_epi32(_mm_cvttps_epi32(_mm_add_ps(clamped, half)),
+                             bias);
+    };
+
+    for (; i + 8u <= count; i += 8u)
+    {
+        auto const low = to_biased_int(_mm_loadu_ps(values + i));
+        auto const high = to_biased_int(_mm_loadu_ps(values + i + 4u));
+        auto const packed =
+            _mm_xor_si128(_mm_packs_epi32(low, high), sign_bit);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(quantized + i), packed);
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        auto const axis = static_cast<glm::length_t>(i % 2u);
+        auto const scaled = (values[i] - min[axis]) * scale[axis];
+        auto const clamped =
+            std::min(std::max(0.0f, scaled), Quantization::max_value);
+        quantized[i] = static_cast<std::uint16_t>(clamped + 0.5f);
+    }
+}
+
+/**
+ * Inverse of quantize_interleaved(), with step the inverse of its scale
+ */
+void
+dequantize_interleaved(std::uint16_t const* const quantized,
+                       std::size_t const count,
+                       glm::vec2 const min,
+                       glm::vec2 const step,
+                       float* const values)
+{
+    auto i = std::size_t{ 0 };
+
+#if defined(__SSE2__)
+    auto const min4 = _mm_setr_ps(min.x, min.y, min.x, min.y);
+    auto const step4 = _mm_setr_ps(step.x, step.y, step.x, step.y);
+    auto const zero = _mm_setzero_si128();
+
+    for (; i + 8u <= count; i += 8u)
+    {
+        auto const packed = _mm_loadu_si128(
+            reinterpret_cast<__m128i const*>(quantized + i));
+        auto const low = _mm_cvtepi32_ps(_mm_unpacklo_epi16(packed, zero));
+        auto const high = _mm_cvtepi32_ps(_mm_unpackhi_epi16(packed, zero));
+        _mm_storeu_ps(values + i, _mm_add_ps(_mm_mul_ps(low, step4), min4));
+        _mm_storeu_ps(values + i + 4u,
+                      _mm_add_ps(_mm_mul_ps(high, step4), min4));
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        auto const axis = static_cast<glm::length_t>(i % 2u);
+        values[i] = static_cast<float>(quantized[i]) * step[axis] + min[axis];
+    }
+}
+
+} // namespace
+
+auto
+Quantization::bounding(std::span<glm::vec2 const> const points)
+    -> Quantization
+{
+    if (points.empty())
+    {
+        return {};
+    }
+
+    auto quantization = Quantization{ points.front(), points.front() };
+    for (auto const point : points)
+    {
+        quantization.min = glm::min(quantization.min, point);
+        quantization.max = glm::max(quantization.max, point);
+    }
+
+    for (auto axis = glm::length_t{ 0 }; axis < 2; ++axis)
+    {
+        if (quantization.max[axis] <= quantization.min[axis])
+        {
+            quantization.max[axis] = quantization.min[axis] + 1.0f;
+        }
+    }
+
+    return quantization;
+}
+
+void
+quantize(std::span<glm::vec2 const> const points,
+         Quantization const& quantization,
+         std::span<glm::u16vec2> const quantized)
+{
+    Expects(quantized.size() == points.size());
+
+    quantize_interleaved(
+        reinterpret_cast<float const*>(points.data()),
+        2u * points.size(),
+        quantization.min,
+        Quantization::max_value / (quantization.max - quantization.min),
+        reinterpret_cast<std::uint16_t*>(quantized.data()));
+}
+
+void
+dequantize(std::span<glm::u16vec2 const> const quantized,
+           Quantization const& quantization,
+           std::span<glm::vec2> const points)
+{
+    Expects(points.size() == quantized.size());
+
+    dequantize_interleaved(
+        reinterpret_cast<std::uint16_t const*>(quantized.data()),
+        2u * quantized.size(),
+        quantization.min,
+        (quantization.max - quantization.min) / Quantization::max_value,
+        reinterpret_cast<float*>(points.data()));
+}
+
+void
+quantize(std::span<float const> const values,
+         float const min,
+         float const max,
+         std::span<std::uint16_t> const quantized)
+{
+    Expects(quantized.size() == values.size());
+
+    quantize_interleaved(values.data(),
+                         values.size(),
+                         glm::vec2(min),
+                         glm::vec2(Quantization::max_value / (max - min)),
+                         quantized.data());
+}
+
+void
+dequantize(std::span<std::uint16_t const> const quantized,
+           float const min,
+           float const max,
+           std::span<float> const values)
+{
+    Expects(values.size() == quantized.size());
+
+    dequantize_interleaved(quantized.data(),
+                           quantized.size(),
+                           glm::vec2(min),
+                           glm::vec2((max - min) / Quantization::max_value),
+                           values.data());
+}
+
+} // namespace pa093::datastructure
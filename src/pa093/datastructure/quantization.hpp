@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/type_precision.hpp>
+
+namespace pa093::datastructure
+{
+
+/**
+ * Maps the rectangle [min, max] to 16-bit unsigned normalized integers per
+ * axis, i.e. 0 to min and 65535 to max. Coordinates outside the rectangle
+ * are clamped to it.
+ */
+struct Quantization
+{
+    static constexpr auto max_value = 65535.0f;
+
+    glm::vec2 min = glm::vec2(-1.0f);
+    glm::vec2 max = glm::vec2(1.0f);
+
+    /**
+     * Bounding rectangle of the points, widened in degenerate dimensions;
+     * the default rectangle if there are no points
+     */
+    [[nodiscard]] static auto bounding(std::span<glm::vec2 const> points)
+        -> Quantization;
+
+    [[nodiscard]] auto contains(glm::vec2 const point) const noexcept -> bool
+    {
+        return glm::all(glm::greaterThanEqual(point, min)) and
+               glm::all(glm::lessThanEqual(point, max));
+    }
+
+    /**
+     * Largest distance per axis between a point in the rectangle and its
+     * dequantized value
+     */
+    [[nodiscard]] auto max_error() const noexcept -> glm::vec2
+    {
+        return (max - min) / max_value / 2.0f;
+    }
+};
+
+void
+quantize(std::span<glm::vec2 const> points,
+         Quantization const& quantization,
+         std::span<glm::u16vec2> quantized);
+
+void
+dequantize(std::span<glm::u16vec2 const> quantized,
+           Quantization const& quantization,
+           std::span<glm::vec2> points);
+
+/**
+ * Quantizes a single coordinate column, mapping [min, max] to [0, 65535]
+ */
+void
+quantize(std::span<float const> values,
+         float min,
+         float max,
+         std::span<std::uint16_t> quantized);
+
+void
+dequantize(std::span<std::uint16_t const> quantized,
+           float min,
+           float max,
+           std::span<float> values);
+
+} // namespace pa093::datastructure
@@ -0,0 +1,149 @@
+#include <pa093/datastructure/triangulation.hpp>
+
+namespace pa093::datastructure
+{
+
+template<typename T>
+void
+BasicTriangulation<T>::flip(index_type const a) noexcept
+{
+    auto const b = halfedges_[a];
+    Expects(b != invalid_index);
+
+    auto const al = next_halfedge(a);
+    auto const ar = prev_halfedge(a);
+    auto const br = next_halfedge(b);
+    auto const bl = prev_halfedge(b);
+
+    // Triangles (p0, pr, pl) and (p1, pl, pr) sharing the diagonal (pr, pl)
+    // become (p0, p1, pl) and (p1, p0, pr) sharing the diagonal (p0, p1).
+    auto const p0 = triangles_[ar];
+    auto const pr = triangles_[a];
+    auto const pl = triangles_[al];
+    auto const p1 = triangles_[bl];
+
+    auto const hbl = halfedges_[bl];
+    auto const har = halfedges_[ar];
+
+    triangles_[a] = p1;
+    triangles_[b] = p0;
+
+    link(a, hbl);
+    link(b, har);
+    link(ar, bl);
+
+    // Half-edges a and b changed their origin; the contents of bl and ar
+    // moved to a and b respectively.
+    if (vertex_halfedges_[pr] == a)
+    {
+        vertex_halfedges_[pr] = br;
+    }
+    if (vertex_halfedges_[pl] == b)
+    {
+        vertex_halfedges_[pl] = al;
+    }
+    if (vertex_halfedges_[p1] == bl and hbl == invalid_index)
+    {
+        vertex_halfedges_[p1] = a;
+    }
+    if (vertex_halfedges_[p0] == ar and har == invalid_index)
+    {
+        vertex_halfedges_[p0] = b;
+    }
+}
+
+template<typename T>
+auto
+BasicTriangulation<T>::split_triangle(index_type const e, index_type const i)
+    -> index_type
+{
+    auto const e1 = next_halfedge(e);
+    auto const e2 = prev_halfedge(e);
+
+    // Triangle (a, b, c) becomes (a, b, i), (b, c, i) and (c, a, i)
+    auto const a = triangles_[e];
+    auto const b = triangles_[e1];
+    auto const c = triangles_[e2];
+
+    auto const h1 = halfedges_[e1];
+    auto const h2 = halfedges_[e2];
+
+    triangles_[e2] = i;
+
+    auto const n1 = add_triangle(b, c, i);
+    auto const n2 = add_triangle(c, a, i);
+
+    link(n1, h1);
+    link(n2, h2);
+    link(e1, n1 + 2u);
+    link(e2, n2 + 1u);
+    link(n1 + 1u, n2 + 2u);
+
+    if (vertex_halfedges_[b] == e1)
+    {
+        vertex_halfedges_[b] = n1;
+    }
+    if (vertex_halfedges_[c] == e2)
+    {
+        vertex_halfedges_[c] = n2;
+    }
+    vertex_halfedges_[i] = e2;
+
+    return n1;
+}
+
+template<typename T>
+auto
+BasicTriangulation<T>::split_hull_edge(index_type const e, index_type const i)
+    -> index_type
+{
+    Expects(halfedges_[e] == invalid_index);
+
+    auto const e1 = next_halfedge(e);
+
+    // Triangle (a, b, c) becomes (a, i, c) and (i, b, c)
+    auto const b = triangles_[e1];
+    auto const c = triangles_[prev_halfedge(e)];
+
+    auto const h1 = halfedges_[e1];
+
+    triangles_[e1] = i;
+
+    auto const n = add_triangle(i, b, c);
+
+    link(n + 1u, h1);
+    link(e1, n + 2u);
+
+    if (vertex_halfedges_[b] == e1)
+    {
+        vertex_halfedges_[b] = n + 1u;
+    }
+    vertex_halfedges_[i] = n;
+
+    return n;
+}
+
+template<typename T>
+void
+BasicTriangulation<T>::update_vertex_halfedges()
+{
+    vertex_halfedges_.assign(points_.size(), invalid_index);
+
+    for (auto e = index_type{ 0 }; e < triangles_.size(); ++e)
+    {
+        auto& vertex_halfedge = vertex_halfedges_[triangles_[e]];
+
+        // Prefer hull edges, so that rotations around hull points start at
+        // the boundary
+        if (vertex_halfedge == invalid_index or
+            halfedges_[e] == invalid_index)
+        {
+            vertex_halfedge = e;
+        }
+    }
+}
+
+template class BasicTriangulation<float>;
+template class BasicTriangulation<std::int32_t>;
+
+} // namespace pa093::datastructure
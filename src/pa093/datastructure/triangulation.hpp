@@ -0,0 +1,317 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <gsl/gsl_assert>
+
+namespace pa093::datastructure
+{
+
+/**
+ * Indexed triangulation stored as a half-edge structure.
+ *
+ * Triangle t owns the half-edges 3t, 3t + 1 and 3t + 2, and half-edge e runs
+ * from point origin(e) to point origin(next_halfedge(e)). Triangles are
+ * counter-clockwise. twin(e) is the opposite half-edge in the adjacent
+ * triangle, or invalid_index on the convex hull.
+ *
+ * Points have coordinates of type T; see Triangulation for floating point and
+ * GridTriangulation for integer grid coordinates.
+ */
+template<typename T>
+class BasicTriangulation
+{
+public:
+    using scalar_type = T;
+    using point_type = glm::vec<2, scalar_type>;
+    using index_type = std::uint32_t;
+    using edge_type = std::array<index_type, 2u>;
+    using triangle_type = std::array<index_type, 3u>;
+
+    static constexpr auto invalid_index =
+        std::numeric_limits<index_type>::max();
+
+    [[nodiscard]] static constexpr auto next_halfedge(
+        index_type const e) noexcept -> index_type
+    {
+        return e % 3u == 2u ? e - 2u : e + 1u;
+    }
+
+    [[nodiscard]] static constexpr auto prev_halfedge(
+        index_type const e) noexcept -> index_type
+    {
+        return e % 3u == 0u ? e + 2u : e - 1u;
+    }
+
+    [[nodiscard]] static constexpr auto triangle_of(
+        index_type const e) noexcept -> index_type
+    {
+        return e / 3u;
+    }
+
+    [[nodiscard]] auto num_points() const noexcept -> std::size_t
+    {
+        return points_.size();
+    }
+
+    [[nodiscard]] auto num_triangles() const noexcept -> std::size_t
+    {
+        return triangles_.size() / 3u;
+    }
+
+    [[nodiscard]] auto num_halfedges() const noexcept -> std::size_t
+    {
+        return triangles_.size();
+    }
+
+    [[nodiscard]] auto points() const noexcept -> std::span<point_type const>
+    {
+        return points_;
+    }
+
+    [[nodiscard]] auto points() noexcept -> std::span<point_type>
+    {
+        return points_;
+    }
+
+    [[nodiscard]] auto point(index_type const i) const noexcept -> point_type
+    {
+        Expects(i < points_.size());
+        return points_[i];
+    }
+
+    /**
+     * Point indices of all triangles, three per triangle
+     */
+    [[nodiscard]] auto triangles() const noexcept
+        -> std::span<index_type const>
+    {
+        return triangles_;
+    }
+
+    [[nodiscard]] auto triangle(index_type const t) const noexcept
+        -> triangle_type
+    {
+        Expects(t < num_triangles());
+        return { triangles_[3u * t],
+                 triangles_[3u * t + 1u],
+                 triangles_[3u * t + 2u] };
+    }
+
+    [[nodiscard]] auto origin(index_type const e) const noexcept -> index_type
+    {
+        Expects(e < triangles_.size());
+        return triangles_[e];
+    }
+
+    [[nodiscard]] auto target(index_type const e) const noexcept -> index_type
+    {
+        return origin(next_halfedge(e));
+    }
+
+    [[nodiscard]] auto twin(index_type const e) const noexcept -> index_type
+    {
+        Expects(e < halfedges_.size());
+        return halfedges_[e];
+    }
+
+    [[nodiscard]] auto is_hull_edge(index_type const e) const noexcept -> bool
+    {
+        return twin(e) == invalid_index;
+    }
+
+    /**
+     * A half-edge starting at the given point, or invalid_index for points
+     * not present in the triangulation (duplicates, fully collinear input).
+     * For points on the convex hull, this is always the outgoing hull edge,
+     * so that rotating with twin(prev_halfedge(e)) visits every incident
+     * triangle counter-clockwise.
+     */
+    [[nodiscard]] auto vertex_halfedge(index_type const i) const noexcept
+        -> index_type
+    {
+        Expects(i < vertex_halfedges_.size());
+        return vertex_halfedges_[i];
+    }
+
+    /**
+     * Convex hull point indices, counter-clockwise. For fully collinear input
+     * this is the sorted sequence of points along the line.
+     */
+    [[nodiscard]] auto hull() const noexcept -> std::span<index_type const>
+    {
+        return hull_;
+    }
+
+    /**
+     * Pairs of (skipped point, coincident triangulated point)
+     */
+    [[nodiscard]] auto duplicates() const noexcept
+        -> std::span<edge_type const>
+    {
+        return duplicates_;
+    }
+
+    /**
+     * Calls f(e) for each outgoing half-edge of the given point,
+     * counter-clockwise. Returns the last visited half-edge.
+     */
+    template<std::invocable<index_type> F>
+    auto for_each_outgoing(index_type const i, F&& f) const -> index_type
+    {
+        auto const start = vertex_halfedge(i);
+        auto e = start;
+        auto last = start;
+
+        while (e != invalid_index)
+        {
+            f(e);
+            last = e;
+            e = twin(prev_halfedge(e));
+
+            if (e == start)
+            {
+                break;
+            }
+        }
+
+        return last;
+    }
+
+    /**
+     * Calls f(e) once per undirected edge of the triangulation, with e being
+     * one of the edge's half-edges.
+     */
+    template<std::invocable<index_type> F>
+    void for_each_edge(F&& f) const
+    {
+        for (auto e = index_type{ 0 }; e < halfedges_.size(); ++e)
+        {
+            if (auto const t = halfedges_[e]; t == invalid_index or e < t)
+            {
+                f(e);
+            }
+        }
+    }
+
+    void clear()
+    {
+        points_.clear();
+        triangles_.clear();
+        halfedges_.clear();
+        vertex_halfedges_.clear();
+        hull_.clear();
+        duplicates_.clear();
+    }
+
+    /**
+     * Removes all triangles, keeping the points.
+     */
+    void clear_triangles()
+    {
+        triangles_.clear();
+        halfedges_.clear();
+        vertex_halfedges_.assign(points_.size(), invalid_index);
+        hull_.clear();
+        duplicates_.clear();
+    }
+
+    template<std::input_iterator I, std::sentinel_for<I> S>
+    requires std::same_as<std::iter_value_t<I>, point_type>
+    void assign_points(I const first, S const last)
+    {
+        clear();
+        points_.assign(first, last);
+        vertex_halfedges_.assign(points_.size(), invalid_index);
+    }
+
+    void reserve_triangles(std::size_t const count)
+    {
+        triangles_.reserve(3u * count);
+        halfedges_.reserve(3u * count);
+    }
+
+    /**
+     * Appends a triangle with unlinked half-edges; returns its first
+     * half-edge.
+     */
+    auto add_triangle(index_type const a,
+                      index_type const b,
+                      index_type const c) -> index_type
+    {
+        auto const e = static_cast<index_type>(triangles_.size());
+        triangles_.insert(triangles_.end(), { a, b, c });
+        halfedges_.insert(halfedges_.end(),
+                          { invalid_index, invalid_index, invalid_index });
+        return e;
+    }
+
+    void link(index_type const e1, index_type const e2) noexcept
+    {
+        halfedges_[e1] = e2;
+        if (e2 != invalid_index)
+        {
+            halfedges_[e2] = e1;
+        }
+    }
+
+    /**
+     * Flips the diagonal of the quad formed by the triangles adjacent to the
+     * internal half-edge a. The half-edges a and twin(a) become the new
+     * diagonal's neighbours, and half-edges keep their triangles.
+     */
+    void flip(index_type a) noexcept;
+
+    /**
+     * Splits the triangle of half-edge e into three around point i, which
+     * lies inside it or on one of its internal edges. The triangle keeps e;
+     * the other two edges move to the returned half-edge and three past it.
+     * Each of these three outer half-edges is opposite to i.
+     */
+    auto split_triangle(index_type e, index_type i) -> index_type;
+
+    /**
+     * Splits the hull half-edge e and its triangle in two at point i, which
+     * lies on it. e becomes the hull edge to i, and the returned half-edge
+     * the hull edge from i; the one after it is the outer edge of the new
+     * triangle, opposite to i.
+     */
+    auto split_hull_edge(index_type e, index_type i) -> index_type;
+
+    void set_hull(std::span<index_type const> hull)
+    {
+        hull_.assign(hull.begin(), hull.end());
+    }
+
+    void add_duplicate(index_type const skipped, index_type const kept)
+    {
+        duplicates_.push_back({ skipped, kept });
+    }
+
+    /**
+     * Recomputes vertex_halfedge for all points.
+     */
+    void update_vertex_halfedges();
+
+private:
+    std::vector<point_type> points_;
+    std::vector<index_type> triangles_;
+    std::vector<index_type> halfedges_;
+    std::vector<index_type> vertex_halfedges_;
+    std::vector<index_type> hull_;
+    std::vector<edge_type> duplicates_;
+};
+
+using Triangulation = BasicTriangulation<float>;
+using GridTriangulation = BasicTriangulation<std::int32_t>;
+
+} // namespace pa093::datastructure
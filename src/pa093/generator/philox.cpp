@@ -0,0 +1 @@
+#include <pa093/generator/philox.hpp>
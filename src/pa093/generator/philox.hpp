@@ -0,0 +1,107 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace pa093::generator
+{
+
+/**
+ * Philox4x32-10 counter-based random number generator (Salmon et al.,
+ * Parallel Random Numbers: As Easy as 1, 2, 3).
+ *
+ * Maps every 128-bit counter to four 32-bit random values under a 64-bit
+ * key. It has no state, so any part of a random stream can be computed
+ * directly, on any thread and in any order.
+ */
+class Philox
+{
+public:
+    using block_type = std::array<std::uint32_t, 4u>;
+
+    static constexpr auto num_rounds = 10;
+
+    explicit constexpr Philox(std::uint64_t const key) noexcept
+        : key_{ static_cast<std::uint32_t>(key),
+                static_cast<std::uint32_t>(key >> 32u) }
+    {
+    }
+
+    [[nodiscard]] constexpr auto operator()(block_type counter) const noexcept
+        -> block_type
+    {
+        auto key = key_;
+        for (auto round = 0; round < num_rounds; ++round)
+        {
+            auto const product0 = std::uint64_t{ multiplier0 } * counter[0];
+            auto const product1 = std::uint64_t{ multiplier1 } * counter[2];
+
+            counter = {
+                static_cast<std::uint32_t>(product1 >> 32u) ^ counter[1] ^
+                    key[0],
+                static_cast<std::uint32_t>(product1),
+                static_cast<std::uint32_t>(product0 >> 32u) ^ counter[3] ^
+                    key[1],
+                static_cast<std::uint32_t>(product0),
+            };
+
+            key[0] += weyl0;
+            key[1] += weyl1;
+        }
+
+        return counter;
+    }
+
+    /**
+     * Block number index of the given stream
+     */
+    [[nodiscard]] constexpr auto
+    operator()(std::uint64_t const index,
+               std::uint32_t const stream) const noexcept -> block_type
+    {
+        return (*this)({
+            static_cast<std::uint32_t>(index),
+            static_cast<std::uint32_t>(index >> 32u),
+            stream,
+            0u,
+        });
+    }
+
+private:
+    static constexpr auto multiplier0 = std::uint32_t{ 0xD2511F53u };
+    static constexpr auto multiplier1 = std::uint32_t{ 0xCD9E8D57u };
+    static constexpr auto weyl0 = std::uint32_t{ 0x9E3779B9u };
+    static constexpr auto weyl1 = std::uint32_t{ 0xBB67AE85u };
+
+    std::array<std::uint32_t, 2u> key_;
+};
+
+/**
+ * Uniform float in [0, 1), using the upper 24 bits
+ */
+[[nodiscard]] constexpr auto
+unit_float(std::uint32_t const bits) noexcept -> float
+{
+    return static_cast<float>(bits >> 8u) * 0x1p-24f;
+}
+
+/**
+ * Uniform float in [-1, 1), using the upper 24 bits
+ */
+[[nodiscard]] constexpr auto
+signed_unit_float(std::uint32_t const bits) noexcept -> float
+{
+    return static_cast<float>(bits >> 8u) * 0x1p-23f - 1.0f;
+}
+
+/**
+ * Uniform integer in [0, bound), without division
+ */
+[[nodiscard]] constexpr auto
+bounded(std::uint32_t const bits, std::uint32_t const bound) noexcept
+    -> std::uint32_t
+{
+    return static_cast<std::uint32_t>((std::uint64_t{ bits } * bound) >> 32u);
+}
+
+} // namespace pa093::generator
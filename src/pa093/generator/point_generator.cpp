@@ -0,0 +1,219 @@
+#include <pa093/generator/point_generator.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+#include <gsl/gsl_assert>
+
+#include <pa093/concurrency/parallel_for.hpp>
+#include <pa093/generator/philox.hpp>
+#include <pa093/profiling/profiler.hpp>
+
+namespace pa093::generator
+{
+
+namespace
+{
+
+// Independent random streams of a seed
+constexpr auto points_stream = std::uint32_t{ 0u };
+constexpr auto centers_stream = std::uint32_t{ 1u };
+constexpr auto seeds_stream = std::uint32_t{ 2u };
+
+/**
+ * Cluster centers are kept away from the bounds, so that most of every
+ * cluster is inside them
+ */
+constexpr auto cluster_center_extent = 0.8f;
+
+constexpr auto max_grid_size = std::uint32_t{ 1u } << 16u;
+
+constexpr auto two_pi = 2.0f * std::numbers::pi_v<float>;
+
+[[nodiscard]] auto
+on_circle(float const radius, std::uint32_t const bits) noexcept -> glm::vec2
+{
+    auto const angle = two_pi * unit_float(bits);
+    return radius * glm::vec2{ std::cos(angle), std::sin(angle) };
+}
+
+/**
+ * Two independent standard normal values (Box-Muller transform)
+ */
+[[nodiscard]] auto
+normal_pair(std::uint32_t const bits1, std::uint32_t const bits2) noexcept
+    -> glm::vec2
+{
+    // In (0, 1], so that the logarithm is finite
+    auto const u = static_cast<float>((bits1 >> 8u) + 1u) * 0x1p-24f;
+    return on_circle(std::sqrt(-2.0f * std::log(u)), bits2);
+}
+
+template<typename F>
+void
+fill(std::uint64_t const first,
+     std::span<glm::vec2> const result,
+     concurrency::JobSystem& jobs,
+     F const& point)
+{
+    concurrency::parallel_for_chunks(
+        jobs,
+        result.size(),
+        [&](std::size_t, std::size_t const begin, std::size_t const end)
+        {
+            for (auto i = begin; i < end; ++i)
+            {
+                result[i] = point(first + i);
+            }
+        },
+        std::size_t{ 1 } << 16u);
+}
+
+} // namespace
+
+auto
+distribution_name(Distribution const distribution) noexcept
+    -> std::string_view
+{
+    auto const it = std::ranges::find(distribution_names,
+                                      distribution,
+                                      [](auto const& entry)
+                                      { return entry.second; });
+
+    return it != distribution_names.end() ? it->first : std::string_view{};
+}
+
+auto
+PointDistribution::valid() const noexcept -> bool
+{
+    // Written so that NaN parameters are invalid
+    return not distribution_name(distribution).empty() and
+           num_clusters > 0u and cluster_sigma >= 0.0f and
+           cluster_sigma <= 1.0f and inner_radius >= 0.0f and
+           inner_radius <= outer_radius and outer_radius <= 1.0f and
+           grid_size >= 2u and grid_size <= max_grid_size and
+           grid_jitter >= 0.0f and grid_jitter <= 1.0f;
+}
+
+void
+generate_points(PointDistribution const& distribution,
+                std::uint64_t const seed,
+                std::uint64_t const first,
+                std::span<glm::vec2> const result,
+                concurrency::JobSystem& jobs)
+{
+    Expects(distribution.valid());
+
+    PA093_PROFILE_SCOPE("Generate points");
+
+    auto const philox = Philox{ seed };
+
+    switch (distribution.distribution)
+    {
+        case Distribution::uniform:
+        {
+            fill(first,
+                 result,
+                 jobs,
+                 [&](std::uint64_t const i)
+                 {
+                     auto const bits = philox(i, points_stream);
+                     return glm::vec2{ signed_unit_float(bits[0]),
+                                       signed_unit_float(bits[1]) };
+                 });
+            break;
+        }
+        case Distribution::gaussian_clusters:
+        {
+            auto centers = std::vector<glm::vec2>(distribution.num_clusters);
+            for (auto c = std::size_t{ 0 }; c < centers.size(); ++c)
+            {
+                auto const bits = philox(c, centers_stream);
+                centers[c] = cluster_center_extent *
+                             glm::vec2{ signed_unit_float(bits[0]),
+                                        signed_unit_float(bits[1]) };
+            }
+
+            auto const sigma = distribution.cluster_sigma;
+            auto const num_clusters = distribution.num_clusters;
+            fill(first,
+                 result,
+                 jobs,
+                 [&](std::uint64_t const i)
+                 {
+                     auto const bits = philox(i, points_stream);
+                     auto const cluster = bounded(bits[0], num_clusters);
+                     return glm::clamp(
+                         centers[cluster] +
+                             sigma * normal_pair(bits[1], bits[2]),
+                         glm::vec2(-1.0f),
+                         glm::vec2(1.0f));
+                 });
+            break;
+        }
+        case Distribution::annulus:
+        {
+            // Uniform by area: the squared radius is uniform
+            auto const inner2 =
+                distribution.inner_radius * distribution.inner_radius;
+            auto const outer2 =
+                distribution.outer_radius * distribution.outer_radius;
+            fill(first,
+                 result,
+                 jobs,
+                 [&](std::uint64_t const i)
+                 {
+                     auto const bits = philox(i, points_stream);
+                     auto const radius = std::sqrt(
+                         inner2 + unit_float(bits[0]) * (outer2 - inner2));
+                     return on_circle(radius, bits[1]);
+                 });
+            break;
+        }
+        case Distribution::grid:
+        {
+            auto const grid_size = distribution.grid_size;
+            auto const spacing = 2.0f / static_cast<float>(grid_size - 1u);
+            auto const jitter = distribution.grid_jitter * spacing;
+            fill(first,
+                 result,
+                 jobs,
+                 [&](std::uint64_t const i)
+                 {
+                     auto const bits = philox(i, points_stream);
+                     auto const cell = glm::vec2{
+                         static_cast<float>(bounded(bits[0], grid_size)),
+                         static_cast<float>(bounded(bits[1], grid_size)),
+                     };
+                     auto const offset =
+                         jitter * glm::vec2{ signed_unit_float(bits[2]),
+                                             signed_unit_float(bits[3]) };
+                     return glm::clamp(-1.0f + spacing * cell + offset,
+                                       glm::vec2(-1.0f),
+                                       glm::vec2(1.0f));
+                 });
+            break;
+        }
+    }
+}
+
+auto
+generate_points(PointDistribution const& distribution,
+                std::size_t const count,
+                std::uint64_t const seed) -> std::vector<glm::vec2>
+{
+    auto points = std::vector<glm::vec2>(count);
+    generate_points(distribution, seed, 0u, points);
+    return points;
+}
+
+auto
+derive_seed(std::uint64_t const seed, std::uint64_t const index) noexcept
+    -> std::uint64_t
+{
+    auto const bits = Philox{ seed }(index, seeds_stream);
+    return std::uint64_t{ bits[0] } | (std::uint64_t{ bits[1] } << 32u);
+}
+
+} // namespace pa093::generator
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <pa093/concurrency/job_system.hpp>
+
+namespace pa093::generator
+{
+
+enum class Distribution
+{
+    /** Uniform in [-1, 1]^2 */
+    uniform,
+    /** Normally distributed around random centers */
+    gaussian_clusters,
+    /** Uniform by area between two circles; on a circle if they coincide */
+    annulus,
+    /** On a regular grid, optionally jittered; exact duplicates otherwise */
+    grid,
+};
+
+inline constexpr auto distribution_names =
+    std::array<std::pair<std::string_view, Distribution>, 4u>{ {
+        { "uniform", Distribution::uniform },
+        { "gaussian_clusters", Distribution::gaussian_clusters },
+        { "annulus", Distribution::annulus },
+        { "grid", Distribution::grid },
+    } };
+
+[[nodiscard]] auto
+distribution_name(Distribution distribution) noexcept -> std::string_view;
+
+/**
+ * A distribution and its parameters; only those of the selected
+ * distribution are used. All points lie in [-1, 1]^2.
+ */
+struct PointDistribution
+{
+    Distribution distribution = Distribution::uniform;
+
+    std::uint32_t num_clusters = 16u;
+    float cluster_sigma = 0.05f;
+
+    float inner_radius = 0.5f;
+    float outer_radius = 0.9f;
+
+    /**
+     * Grid points per side, spanning [-1, 1]
+     */
+    std::uint32_t grid_size = 64u;
+    /**
+     * Largest offset from the grid point, as a fraction of the grid spacing
+     */
+    float grid_jitter = 0.0f;
+
+    [[nodiscard]] auto valid() const noexcept -> bool;
+
+    auto operator==(PointDistribution const&) const -> bool = default;
+};
+
+/**
+ * Writes the points with indices [first, first + result.size()) of the
+ * random stream of the seed, in parallel. Every point depends only on the
+ * distribution, the seed and its index, so a stream can be generated in
+ * any number of calls and threads with the same result.
+ */
+void
+generate_points(PointDistribution const& distribution,
+                std::uint64_t seed,
+                std::uint64_t first,
+                std::span<glm::vec2> result,
+                concurrency::JobSystem& jobs =
+                    concurrency::JobSystem::instance());
+
+/**
+ * The first count points of the random stream of the seed
+ */
+[[nodiscard]] auto
+generate_points(PointDistribution const& distribution,
+                std::size_t count,
+                std::uint64_t seed = 0u) -> std::vector<glm::vec2>;
+
+/**
+ * A seed derived from another one, different for every index
+ */
+[[nodiscard]] auto
+derive_seed(std::uint64_t seed, std::uint64_t index) noexcept
+    -> std::uint64_t;
+
+} // namespace pa093::generator
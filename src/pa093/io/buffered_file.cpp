@@ -0,0 +1,184 @@
+#include <pa093/io/buffered_file.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+namespace pa093::io
+{
+
+namespace
+{
+
+void
+seek(std::FILE* const file, std::uint64_t const offset, int const origin)
+{
+#ifdef _WIN32
+    auto const result =
+        _fseeki64(file, static_cast<long long>(offset), origin);
+#else
+    auto const result = fseeko(file, static_cast<off_t>(offset), origin);
+#endif
+    if (result != 0)
+    {
+        throw std::runtime_error{ "Cannot seek in file" };
+    }
+}
+
+} // namespace
+
+void
+BufferedFile::FileCloser::operator()(std::FILE* const file) const noexcept
+{
+    std::fclose(file);
+}
+
+BufferedFile::BufferedFile(std::FILE* const file,
+                           std::size_t const buffer_size)
+    : file_{ file }
+    , buffer_(std::max(buffer_size, std::size_t{ 1 }))
+{
+}
+
+auto
+BufferedFile::create(std::filesystem::path const& path,
+                     std::size_t const buffer_size) -> BufferedFile
+{
+#ifdef _WIN32
+    auto* const file = _wfopen(path.c_str(), L"wb");
+#else
+    auto* const file = std::fopen(path.c_str(), "wb");
+#endif
+    if (not file)
+    {
+        throw std::runtime_error{ fmt::format("Cannot create file {}",
+                                              path.string()) };
+    }
+
+    // Writes are buffered here
+    std::setvbuf(file, nullptr, _IONBF, 0u);
+
+    return { file, buffer_size };
+}
+
+auto
+BufferedFile::temporary(std::size_t const buffer_size) -> BufferedFile
+{
+    auto* const file = std::tmpfile();
+    if (not file)
+    {
+        throw std::runtime_error{ "Cannot create temporary file" };
+    }
+
+    std::setvbuf(file, nullptr, _IONBF, 0u);
+
+    return { file, buffer_size };
+}
+
+void
+BufferedFile::write(std::span<std::byte const> bytes)
+{
+    size_ += bytes.size();
+
+    // Large writes bypass the buffer
+    if (bytes.size() >= buffer_.size())
+    {
+        flush();
+        if (std::fwrite(bytes.data(), 1u, bytes.size(), file_.get()) !=
+            bytes.size())
+        {
+            throw std::runtime_error{ "Cannot write file" };
+        }
+        return;
+    }
+
+    if (bytes.size() > buffer_.size() - buffered_)
+    {
+        flush();
+    }
+
+    std::memcpy(buffer_.data() + buffered_, bytes.data(), bytes.size());
+    buffered_ += bytes.size();
+}
+
+void
+BufferedFile::write_at(std::uint64_t const offset,
+                       std::span<std::byte const> const bytes)
+{
+    if (offset + bytes.size() > size_)
+    {
+        throw std::out_of_range{ "Write past the end of file" };
+    }
+
+    flush();
+    seek(file_.get(), offset, SEEK_SET);
+    auto const written =
+        std::fwrite(bytes.data(), 1u, bytes.size(), file_.get());
+    seek(file_.get(), 0u, SEEK_END);
+
+    if (written != bytes.size())
+    {
+        throw std::runtime_error{ "Cannot write file" };
+    }
+}
+
+void
+BufferedFile::copy_to(BufferedFile& other)
+{
+    flush();
+    seek(file_.get(), 0u, SEEK_SET);
+
+    // Read straight into the other file's buffer
+    other.flush();
+    for (auto remaining = size_; remaining != 0u;)
+    {
+        auto const count = static_cast<std::size_t>(
+            std::min<std::uint64_t>(remaining, other.buffer_.size()));
+        if (std::fread(other.buffer_.data(), 1u, count, file_.get()) != count)
+        {
+            throw std::runtime_error{ "Cannot read file" };
+        }
+
+        other.buffered_ = count;
+        other.size_ += count;
+        other.flush();
+        remaining -= count;
+    }
+
+    seek(file_.get(), 0u, SEEK_END);
+}
+
+void
+BufferedFile::flush()
+{
+    if (buffered_ == 0u)
+    {
+        return;
+    }
+
+    if (std::fwrite(buffer_.data(), 1u, buffered_, file_.get()) != buffered_)
+    {
+        throw std::runtime_error{ "Cannot write file" };
+    }
+
+    buffered_ = 0u;
+}
+
+void
+BufferedFile::close()
+{
+    if (not file_)
+    {
+        return;
+    }
+
+    flush();
+    if (std::fclose(file_.release()) != 0)
+    {
+        throw std::runtime_error{ "Cannot close file" };
+    }
+}
+
+} // namespace pa093::io
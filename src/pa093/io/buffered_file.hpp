@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace pa093::io
+{
+
+/**
+ * Binary file written sequentially through a large buffer, so that the
+ * operating system sees few large writes instead of many small ones.
+ *
+ * All operations throw std::runtime_error on I/O errors.
+ */
+class BufferedFile
+{
+public:
+    static constexpr auto default_buffer_size = std::size_t{ 1 } << 20u;
+
+    /**
+     * Creates (or truncates) a file for writing
+     */
+    [[nodiscard]] static auto create(std::filesystem::path const& path,
+                                     std::size_t buffer_size =
+                                         default_buffer_size) -> BufferedFile;
+
+    /**
+     * Creates an anonymous temporary file, deleted when closed. It can be
+     * read back with copy_to().
+     */
+    [[nodiscard]] static auto temporary(
+        std::size_t buffer_size = default_buffer_size) -> BufferedFile;
+
+    void write(std::span<std::byte const> bytes);
+
+    template<typename T>
+    requires std::is_trivially_copyable_v<T>
+    void write(T const& value)
+    {
+        write(std::as_bytes(std::span{ &value, 1u }));
+    }
+
+    /**
+     * Overwrites already written bytes at offset (e.g. a header with counts
+     * that are only known at the end); the write position is unchanged.
+     */
+    void write_at(std::uint64_t offset, std::span<std::byte const> bytes);
+
+    /**
+     * Number of bytes written so far
+     */
+    [[nodiscard]] auto size() const noexcept -> std::uint64_t
+    {
+        return size_;
+    }
+
+    /**
+     * Appends the whole contents of this file to another one
+     */
+    void copy_to(BufferedFile& other);
+
+    void flush();
+
+    /**
+     * Flushes and closes the file
+     */
+    void close();
+
+private:
+    struct FileCloser
+    {
+        void operator()(std::FILE* file) const noexcept;
+    };
+
+    std::unique_ptr<std::FILE, FileCloser> file_;
+    std::vector<std::byte> buffer_;
+    std::size_t buffered_ = 0u;
+    std::uint64_t size_ = 0u;
+
+    BufferedFile(std::FILE* file, std::size_t buffer_size);
+};
+
+} // namespace pa093::io
@@ -0,0 +1,193 @@
+#include <pa093/io/mapped_file.hpp>
+
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace pa093::io
+{
+
+namespace
+{
+
+[[noreturn]] void
+throw_map_error(std::filesystem::path const& path)
+{
+    throw std::runtime_error{ fmt::format("Cannot map file {}",
+                                          path.string()) };
+}
+
+} // namespace
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(std::filesystem::path const& path)
+{
+    auto const file = CreateFileW(path.c_str(),
+                                  GENERIC_READ,
+                                  FILE_SHARE_READ,
+                                  nullptr,
+                                  OPEN_EXISTING,
+                                  FILE_FLAG_SEQUENTIAL_SCAN,
+                                  nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        throw_map_error(path);
+    }
+
+    auto size = LARGE_INTEGER{};
+    if (not GetFileSizeEx(file, &size))
+    {
+        CloseHandle(file);
+        throw_map_error(path);
+    }
+
+    size_ = static_cast<std::size_t>(size.QuadPart);
+    if (size_ == 0u)
+    {
+        CloseHandle(file);
+        return;
+    }
+
+    mapping_ = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (not mapping_)
+    {
+        throw_map_error(path);
+    }
+
+    data_ = static_cast<std::byte const*>(
+        MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+    if (not data_)
+    {
+        CloseHandle(mapping_);
+        throw_map_error(path);
+    }
+}
+
+void
+MappedFile::unmap() noexcept
+{
+    if (data_)
+    {
+        UnmapViewOfFile(data_);
+    }
+    if (mapping_)
+    {
+        CloseHandle(mapping_);
+    }
+
+    data_ = nullptr;
+    size_ = 0u;
+    mapping_ = nullptr;
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_{ std::exchange(other.data_, nullptr) }
+    , size_{ std::exchange(other.size_, 0u) }
+    , mapping_{ std::exchange(other.mapping_, nullptr) }
+{
+}
+
+auto
+MappedFile::operator=(MappedFile&& other) noexcept -> MappedFile&
+{
+    if (this != &other)
+    {
+        unmap();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0u);
+        mapping_ = std::exchange(other.mapping_, nullptr);
+    }
+
+    return *this;
+}
+
+#else
+
+MappedFile::MappedFile(std::filesystem::path const& path)
+{
+    auto const fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        throw_map_error(path);
+    }
+
+    struct stat status = {};
+    if (::fstat(fd, &status) != 0)
+    {
+        ::close(fd);
+        throw_map_error(path);
+    }
+
+    size_ = static_cast<std::size_t>(status.st_size);
+    if (size_ == 0u)
+    {
+        ::close(fd);
+        return;
+    }
+
+    auto* const data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED)
+    {
+        size_ = 0u;
+        throw_map_error(path);
+    }
+
+    // Loaders scan files front to back
+    ::madvise(data, size_, MADV_SEQUENTIAL);
+    data_ = static_cast<std::byte const*>(data);
+}
+
+void
+MappedFile::unmap() noexcept
+{
+    if (data_)
+    {
+        ::munmap(const_cast<std::byte*>(data_), size_);
+    }
+
+    data_ = nullptr;
+    size_ = 0u;
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_{ std::exchange(other.data_, nullptr) }
+    , size_{ std::exchange(other.size_, 0u) }
+{
+}
+
+auto
+MappedFile::operator=(MappedFile&& other) noexcept -> MappedFile&
+{
+    if (this != &other)
+    {
+        unmap();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0u);
+    }
+
+    return *this;
+}
+
+#endif
+
+MappedFile::~MappedFile()
+{
+    unmap();
+}
+
+} // namespace pa093::io
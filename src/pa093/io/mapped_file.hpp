@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+namespace pa093::io
+{
+
+/**
+ * Read-only memory mapping of a whole file
+ */
+class MappedFile
+{
+public:
+    /**
+     * Throws std::runtime_error if the file cannot be opened or mapped.
+     */
+    [[nodiscard]] explicit MappedFile(std::filesystem::path const& path);
+
+    MappedFile(MappedFile&& other) noexcept;
+
+    auto operator=(MappedFile&& other) noexcept -> MappedFile&;
+
+    MappedFile(MappedFile const&) = delete;
+
+    auto operator=(MappedFile const&) -> MappedFile& = delete;
+
+    ~MappedFile();
+
+    [[nodiscard]] auto bytes() const noexcept -> std::span<std::byte const>
+    {
+        return { data_, size_ };
+    }
+
+private:
+    std::byte const* data_ = nullptr;
+    std::size_t size_ = 0u;
+#ifdef _WIN32
+    void* mapping_ = nullptr;
+#endif
+
+    void unmap() noexcept;
+};
+
+} // namespace pa093::io
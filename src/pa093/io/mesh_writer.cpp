@@ -0,0 +1,147 @@
+#include <pa093/io/mesh_writer.hpp>
+
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+
+#include <fmt/format.h>
+
+namespace pa093::io
+{
+
+MeshWriter::MeshWriter(std::filesystem::path const& path,
+                       MeshFormat const format,
+                       std::size_t const vertices_per_face,
+                       bool const deduplicate,
+                       std::size_t const expected_vertices)
+    : format_{ format }
+    , vertices_per_face_{ vertices_per_face }
+    , deduplicate_{ deduplicate }
+    , file_{ BufferedFile::create(path) }
+    , vertex_indices_{ deduplicate ? expected_vertices : 0u }
+{
+    if (vertices_per_face < 2u or
+        vertices_per_face > std::numeric_limits<std::uint8_t>::max())
+    {
+        throw std::invalid_argument{ "Unsupported number of face vertices" };
+    }
+
+    face_.reserve(vertices_per_face);
+
+    // Placeholder header, rewritten with the final counts by finish()
+    switch (format_)
+    {
+        case MeshFormat::ply:
+        {
+            auto const header = ply_header();
+            file_.write(std::as_bytes(std::span{ header }));
+            break;
+        }
+        case MeshFormat::indexed:
+            file_.write(IndexedMeshHeader{});
+            break;
+    }
+
+    vertex_offset_ = file_.size();
+}
+
+void
+MeshWriter::add_vertex(glm::vec2 const vertex)
+{
+    auto index = static_cast<index_type>(num_vertices_);
+    auto is_new = true;
+
+    if (deduplicate_)
+    {
+        std::tie(index, is_new) = vertex_indices_.try_emplace(vertex, index);
+    }
+
+    if (is_new)
+    {
+        if (num_vertices_ == std::numeric_limits<index_type>::max())
+        {
+            throw std::overflow_error{ "Too many mesh vertices" };
+        }
+
+        file_.write(vertex);
+        ++num_vertices_;
+    }
+
+    face_.push_back(index);
+    if (face_.size() < vertices_per_face_)
+    {
+        return;
+    }
+
+    if (format_ == MeshFormat::ply and vertices_per_face_ != 2u)
+    {
+        // Face element with a list property
+        faces_.write(static_cast<std::uint8_t>(vertices_per_face_));
+    }
+    faces_.write(std::as_bytes(std::span{ face_ }));
+
+    face_.clear();
+    ++num_faces_;
+}
+
+void
+MeshWriter::finish()
+{
+    face_.clear();
+    vertex_indices_.clear();
+
+    auto const face_offset = file_.size();
+    faces_.copy_to(file_);
+    faces_.close();
+
+    switch (format_)
+    {
+        case MeshFormat::ply:
+        {
+            auto const header = ply_header();
+            file_.write_at(0u, std::as_bytes(std::span{ header }));
+            break;
+        }
+        case MeshFormat::indexed:
+        {
+            auto header = IndexedMeshHeader{};
+            header.vertices_per_face =
+                static_cast<std::uint32_t>(vertices_per_face_);
+            header.num_vertices = num_vertices_;
+            header.num_faces = num_faces_;
+            header.vertex_offset = vertex_offset_;
+            header.face_offset = face_offset;
+            file_.write_at(0u, std::as_bytes(std::span{ &header, 1u }));
+            break;
+        }
+    }
+
+    file_.close();
+}
+
+auto
+MeshWriter::ply_header() const -> std::string
+{
+    // Fixed width counts keep the header size constant
+    auto const face_element =
+        vertices_per_face_ == 2u
+            ? fmt::format("element edge {:020}\n"
+                          "property uint vertex1\n"
+                          "property uint vertex2\n",
+                          num_faces_)
+            : fmt::format("element face {:020}\n"
+                          "property list uchar uint vertex_indices\n",
+                          num_faces_);
+
+    return fmt::format("ply\n"
+                       "format binary_little_endian 1.0\n"
+                       "element vertex {:020}\n"
+                       "property float x\n"
+                       "property float y\n"
+                       "{}"
+                       "end_header\n",
+                       num_vertices_,
+                       face_element);
+}
+
+} // namespace pa093::io
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <pa093/io/buffered_file.hpp>
+#include <pa093/io/vertex_index_table.hpp>
+
+namespace pa093::io
+{
+
+enum class MeshFormat
+{
+    /** Binary little-endian PLY with a vertex and a face or edge element */
+    ply,
+    /** PA093 indexed mesh, see IndexedMeshHeader */
+    indexed,
+};
+
+/**
+ * Header of the PA093 indexed mesh format. It is followed by num_vertices
+ * float32 (x, y) pairs at vertex_offset and num_faces faces of
+ * vertices_per_face uint32 vertex indices at face_offset.
+ */
+struct IndexedMeshHeader
+{
+    std::array<char, 8> magic = { 'P', 'A', '0', '9', '3', 'M', 'S', 'H' };
+    std::uint32_t format_version = 1u;
+    std::uint32_t vertices_per_face = 0u;
+    std::uint64_t num_vertices = 0u;
+    std::uint64_t num_faces = 0u;
+    std::uint64_t vertex_offset = 0u;
+    std::uint64_t face_offset = 0u;
+    std::array<std::uint64_t, 2> reserved = {};
+};
+
+static_assert(sizeof(IndexedMeshHeader) == 64u);
+
+/**
+ * Streams a mesh of fixed-size faces (segments or triangles) to disk as it
+ * is produced, from the flat vertex sequences the algorithms output.
+ *
+ * Vertices are written to the file right away and faces to a temporary
+ * file that is appended on finish(), so memory use is bounded by the
+ * vertex deduplication table (a flat table of 12-byte slots, about 16 to
+ * 24 bytes per distinct vertex) rather than by the size of the output.
+ */
+class MeshWriter
+{
+public:
+    using index_type = std::uint32_t;
+
+    /**
+     * Output iterator adding every assigned point with add_vertex()
+     */
+    class VertexSink
+    {
+    public:
+        using difference_type = std::ptrdiff_t;
+
+        explicit VertexSink(MeshWriter& writer) noexcept
+            : writer_{ &writer }
+        {
+        }
+
+        auto operator=(glm::vec2 const vertex) -> VertexSink&
+        {
+            writer_->add_vertex(vertex);
+            return *this;
+        }
+
+        auto operator*() noexcept -> VertexSink& { return *this; }
+
+        auto operator++() noexcept -> VertexSink& { return *this; }
+
+        auto operator++(int) noexcept -> VertexSink { return *this; }
+
+    private:
+        MeshWriter* writer_;
+    };
+
+    /**
+     * Throws std::runtime_error if the file cannot be created. The
+     * deduplication table is sized for expected_vertices distinct vertices
+     * and grows beyond.
+     */
+    [[nodiscard]] MeshWriter(std::filesystem::path const& path,
+                             MeshFormat format,
+                             std::size_t vertices_per_face,
+                             bool deduplicate = true,
+                             std::size_t expected_vertices = 0u);
+
+    /**
+     * Appends a vertex to the current face; every vertices_per_face
+     * vertices complete a face. With deduplication, repeated points are
+     * written once and referenced by index.
+     */
+    void add_vertex(glm::vec2 vertex);
+
+    [[nodiscard]] auto vertex_sink() noexcept -> VertexSink
+    {
+        return VertexSink{ *this };
+    }
+
+    [[nodiscard]] auto vertices_per_face() const noexcept -> std::size_t
+    {
+        return vertices_per_face_;
+    }
+
+    [[nodiscard]] auto num_vertices() const noexcept -> std::uint64_t
+    {
+        return num_vertices_;
+    }
+
+    [[nodiscard]] auto num_faces() const noexcept -> std::uint64_t
+    {
+        return num_faces_;
+    }
+
+    /**
+     * Appends the faces, writes the final counts and closes the file. A
+     * trailing incomplete face is dropped. Without a call to finish(), the
+     * file is left incomplete.
+     */
+    void finish();
+
+private:
+    MeshFormat format_;
+    std::size_t vertices_per_face_;
+    bool deduplicate_;
+    BufferedFile file_;
+    BufferedFile faces_ = BufferedFile::temporary();
+    VertexIndexTable vertex_indices_;
+    std::vector<index_type> face_;
+    std::uint64_t num_vertices_ = 0u;
+    std::uint64_t num_faces_ = 0u;
+    std::uint64_t vertex_offset_ = 0u;
+
+    [[nodiscard]] auto ply_header() const -> std::string;
+};
+
+static_assert(std::output_iterator<MeshWriter::VertexSink, glm::vec2>);
+
+} // namespace pa093::io
@@ -0,0 +1,96 @@
+#include <pa093/io/point_file.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <pa093/datastructure/quantization.hpp>
+#include <pa093/io/mapped_file.hpp>
+#include <pa093/io/point_set_file.hpp>
+#include <pa093/io/text_points.hpp>
+
+namespace pa093::io
+{
+
+auto
+read_points(std::filesystem::path const& path) -> std::vector<glm::vec2>
+{
+    auto points = std::vector<glm::vec2>{};
+
+    auto file = MappedFile{ path };
+    if (is_point_set(file.bytes()))
+    {
+        auto const point_set = PointSetFile{ std::move(file), path };
+
+        points.resize(point_set.size());
+        if (point_set.scalar_type() == ScalarType::unorm16)
+        {
+            // Decode whole columns with the vectorized kernels
+            auto const& quantization = point_set.quantization();
+            auto x_column = std::vector<float>(points.size());
+            auto y_column = std::vector<float>(points.size());
+            datastructure::dequantize(
+                point_set.column<std::uint16_t>(Axis::x),
+                quantization.min.x,
+                quantization.max.x,
+                x_column);
+            datastructure::dequantize(
+                point_set.column<std::uint16_t>(Axis::y),
+                quantization.min.y,
+                quantization.max.y,
+                y_column);
+
+            std::ranges::transform(x_column,
+                                   y_column,
+                                   points.begin(),
+                                   [](float const x, float const y)
+                                   { return glm::vec2{ x, y }; });
+        }
+        else
+        {
+            std::ranges::copy(point_set.points(), points.begin());
+        }
+    }
+    else
+    {
+        auto const columns = read_text_points<float>(file, path);
+
+        points.resize(columns.x.size());
+        std::ranges::transform(columns.x,
+                               columns.y,
+                               points.begin(),
+                               [](float const x, float const y)
+                               { return glm::vec2{ x, y }; });
+    }
+
+    return points;
+}
+
+void
+write_points(std::filesystem::path const& path,
+             std::span<glm::vec2 const> const points)
+{
+    auto file = std::ofstream{ path };
+    if (not file)
+    {
+        throw std::runtime_error{ fmt::format("Cannot write point file {}",
+                                              path.string()) };
+    }
+
+    for (auto const point : points)
+    {
+        file << fmt::format("{} {}\n", point.x, point.y);
+    }
+
+    if (not file.flush())
+    {
+        throw std::runtime_error{ fmt::format("Cannot write point file {}",
+                                              path.string()) };
+    }
+}
+
+} // namespace pa093::io
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <filesystem>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace pa093::io
+{
+
+/**
+ * Reads a binary point set (see point_set_file.hpp) or a text point file
+ * (see parse_text_points()), depending on the file contents.
+ *
+ * Throws std::runtime_error if the file cannot be opened or parsed.
+ */
+[[nodiscard]] auto
+read_points(std::filesystem::path const& path) -> std::vector<glm::vec2>;
+
+/**
+ * Writes points in the format accepted by read_points().
+ *
+ * Throws std::runtime_error if the file cannot be written.
+ */
+void
+write_points(std::filesystem::path const& path,
+             std::span<glm::vec2 const> points);
+
+} // namespace pa093::io
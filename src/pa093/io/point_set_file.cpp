@@ -0,0 +1,378 @@
+#include <pa093/io/point_set_file.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <utility>
+
+#include <fmt/format.h>
+
+namespace pa093::io
+{
+
+static_assert(std::endian::native == std::endian::little,
+              "Point set files are little-endian");
+
+namespace
+{
+
+[[nodiscard]] auto
+align_up(std::uint64_t const offset) noexcept -> std::uint64_t
+{
+    return (offset + column_alignment - 1u) / column_alignment *
+           column_alignment;
+}
+
+[[nodiscard]] auto
+scalar_size(ScalarType const type) -> std::size_t
+{
+    switch (type)
+    {
+        case ScalarType::float32:
+            return sizeof(float);
+        case ScalarType::float64:
+            return sizeof(double);
+        case ScalarType::unorm16:
+            return sizeof(std::uint16_t);
+    }
+
+    throw std::runtime_error{ "Unknown point set scalar type" };
+}
+
+template<typename T>
+[[nodiscard]] auto
+span_at(std::span<std::byte const> const bytes,
+        std::uint64_t const offset,
+        std::size_t const count) -> std::span<T const>
+{
+    return { reinterpret_cast<T const*>(bytes.data() + offset), count };
+}
+
+/**
+ * Bounding boxes of consecutive chunk_size coordinates of the columns, as
+ * mapped by decode
+ */
+template<typename T, typename Decode>
+[[nodiscard]] auto
+chunk_bounds(std::span<T const> const x,
+             std::span<T const> const y,
+             std::size_t const chunk_size,
+             Decode const& decode) -> std::vector<ChunkBounds>
+{
+    auto const n = x.size();
+    auto const num_chunks =
+        chunk_size != 0u ? (n + chunk_size - 1u) / chunk_size : 0u;
+
+    auto chunks = std::vector<ChunkBounds>(num_chunks);
+    for (auto chunk = std::size_t{ 0 }; chunk < num_chunks; ++chunk)
+    {
+        auto const begin = chunk * chunk_size;
+        auto const end = std::min(begin + chunk_size, n);
+        auto const [min_x, max_x] =
+            std::minmax_element(x.begin() + begin, x.begin() + end);
+        auto const [min_y, max_y] =
+            std::minmax_element(y.begin() + begin, y.begin() + end);
+
+        chunks[chunk] = {
+            .min = { decode(*min_x, Axis::x), decode(*min_y, Axis::y) },
+            .max = { decode(*max_x, Axis::x), decode(*max_y, Axis::y) },
+        };
+    }
+
+    return chunks;
+}
+
+/**
+ * Writes the header and the sections it points to; the header offsets are
+ * filled in here
+ */
+void
+write_sections(std::filesystem::path const& path,
+               PointSetHeader header,
+               std::span<std::byte const> const x,
+               std::span<std::byte const> const y,
+               std::span<ChunkBounds const> const chunks,
+               ChunkBounds const* const quantization)
+{
+    header.x_offset = align_up(sizeof(PointSetHeader));
+    header.y_offset = align_up(header.x_offset + x.size());
+    auto end = header.y_offset + y.size();
+    if (not chunks.empty())
+    {
+        header.chunk_index_offset = align_up(end);
+        end = header.chunk_index_offset + chunks.size_bytes();
+    }
+    if (quantization != nullptr)
+    {
+        header.quantization_offset = align_up(end);
+    }
+
+    auto file = std::ofstream{ path, std::ios::binary };
+    if (not file)
+    {
+        throw std::runtime_error{ fmt::format("Cannot write point set {}",
+                                              path.string()) };
+    }
+
+    auto const write_at = [&](std::uint64_t const offset,
+                              void const* const data,
+                              std::size_t const size)
+    {
+        // Zero padding up to the aligned offset
+        constexpr auto padding = std::array<char, column_alignment>{};
+        auto const position = static_cast<std::uint64_t>(file.tellp());
+        file.write(padding.data(),
+                   static_cast<std::streamsize>(offset - position));
+        file.write(static_cast<char const*>(data),
+                   static_cast<std::streamsize>(size));
+    };
+
+    write_at(0u, &header, sizeof(header));
+    write_at(header.x_offset, x.data(), x.size());
+    write_at(header.y_offset, y.data(), y.size());
+    if (not chunks.empty())
+    {
+        write_at(header.chunk_index_offset, chunks.data(), chunks.size_bytes());
+    }
+    if (quantization != nullptr)
+    {
+        write_at(
+            header.quantization_offset, quantization, sizeof(ChunkBounds));
+    }
+
+    if (not file.flush())
+    {
+        throw std::runtime_error{ fmt::format("Cannot write point set {}",
+                                              path.string()) };
+    }
+}
+
+} // namespace
+
+auto
+is_point_set(std::span<std::byte const> const bytes) noexcept -> bool
+{
+    return bytes.size() >= point_set_magic.size() and
+           std::memcmp(bytes.data(),
+                       point_set_magic.data(),
+                       point_set_magic.size()) == 0;
+}
+
+PointSetFile::PointSetFile(std::filesystem::path const& path)
+    : PointSetFile{ MappedFile{ path }, path }
+{
+}
+
+PointSetFile::PointSetFile(MappedFile file, std::filesystem::path const& path)
+    : file_{ std::move(file) }
+{
+    auto const bytes = file_.bytes();
+    auto const invalid = [&](std::string_view const reason)
+    {
+        return std::runtime_error{ fmt::format(
+            "Invalid point set {}: {}", path.string(), reason) };
+    };
+
+    if (bytes.size() < sizeof(PointSetHeader) or not is_point_set(bytes))
+    {
+        throw invalid("missing header");
+    }
+
+    std::memcpy(&header_, bytes.data(), sizeof(PointSetHeader));
+
+    if (header_.format_version != point_set_format_version)
+    {
+        throw invalid("unsupported version");
+    }
+
+    auto const n = header_.num_points;
+    auto const column_size = n * scalar_size(header_.scalar_type);
+    auto const fits = [&](std::uint64_t const offset, std::uint64_t size)
+    {
+        return offset % column_alignment == 0u and offset <= bytes.size() and
+               size <= bytes.size() - offset;
+    };
+
+    if (n > std::numeric_limits<std::uint64_t>::max() / sizeof(double) or
+        not fits(header_.x_offset, column_size) or
+        not fits(header_.y_offset, column_size))
+    {
+        throw invalid("columns out of bounds");
+    }
+
+    if (header_.chunk_size != 0u)
+    {
+        auto const num_chunks =
+            (n + header_.chunk_size - 1u) / header_.chunk_size;
+        if (not fits(header_.chunk_index_offset,
+                     num_chunks * sizeof(ChunkBounds)))
+        {
+            throw invalid("chunk index out of bounds");
+        }
+
+        chunks_ = span_at<ChunkBounds>(
+            bytes, header_.chunk_index_offset, num_chunks);
+    }
+
+    switch (header_.scalar_type)
+    {
+        case ScalarType::float32:
+            float_x_ = span_at<float>(bytes, header_.x_offset, size());
+            float_y_ = span_at<float>(bytes, header_.y_offset, size());
+            break;
+        case ScalarType::float64:
+            double_x_ = span_at<double>(bytes, header_.x_offset, size());
+            double_y_ = span_at<double>(bytes, header_.y_offset, size());
+            break;
+        case ScalarType::unorm16:
+        {
+            if (not fits(header_.quantization_offset, sizeof(ChunkBounds)))
+            {
+                throw invalid("quantization out of bounds");
+            }
+
+            auto const& rectangle =
+                span_at<ChunkBounds>(bytes, header_.quantization_offset, 1u)
+                    .front();
+            quantization_ = {
+                .min = glm::vec2(rectangle.min[0], rectangle.min[1]),
+                .max = glm::vec2(rectangle.max[0], rectangle.max[1]),
+            };
+            if (not glm::all(glm::lessThan(quantization_.min,
+                                           quantization_.max)))
+            {
+                throw invalid("empty quantization rectangle");
+            }
+            quantization_step_ = (quantization_.max - quantization_.min) /
+                                 datastructure::Quantization::max_value;
+
+            unorm16_x_ =
+                span_at<std::uint16_t>(bytes, header_.x_offset, size());
+            unorm16_y_ =
+                span_at<std::uint16_t>(bytes, header_.y_offset, size());
+            break;
+        }
+    }
+}
+
+template<typename T>
+requires std::same_as<T, float> or std::same_as<T, double>
+void
+write_point_set(std::filesystem::path const& path,
+                std::span<T const> const x,
+                std::span<T const> const y,
+                std::size_t const chunk_size)
+{
+    if (x.size() != y.size())
+    {
+        throw std::invalid_argument{ "Point set columns differ in size" };
+    }
+
+    auto header = PointSetHeader{};
+    header.scalar_type = std::same_as<T, float> ? ScalarType::float32
+                                                : ScalarType::float64;
+    header.num_points = x.size();
+    header.chunk_size = chunk_size;
+
+    auto const chunks = chunk_bounds(
+        x, y, chunk_size, [](T const value, Axis) { return value; });
+
+    write_sections(path,
+                   header,
+                   std::as_bytes(x),
+                   std::as_bytes(y),
+                   chunks,
+                   nullptr);
+}
+
+template void
+write_point_set<float>(std::filesystem::path const& path,
+                       std::span<float const> x,
+                       std::span<float const> y,
+                       std::size_t chunk_size);
+
+template void
+write_point_set<double>(std::filesystem::path const& path,
+                        std::span<double const> x,
+                        std::span<double const> y,
+                        std::size_t chunk_size);
+
+void
+write_quantized_point_set(std::filesystem::path const& path,
+                          std::span<float const> const x,
+                          std::span<float const> const y,
+                          std::size_t const chunk_size)
+{
+    if (x.size() != y.size())
+    {
+        throw std::invalid_argument{ "Point set columns differ in size" };
+    }
+
+    auto quantization = datastructure::Quantization{};
+    if (not x.empty())
+    {
+        auto const [min_x, max_x] = std::ranges::minmax(x);
+        auto const [min_y, max_y] = std::ranges::minmax(y);
+        quantization =
+            datastructure::Quantization::bounding(std::array{
+                glm::vec2{ min_x, min_y }, glm::vec2{ max_x, max_y } });
+    }
+
+    auto quantized_x = std::vector<std::uint16_t>(x.size());
+    auto quantized_y = std::vector<std::uint16_t>(y.size());
+    datastructure::quantize(
+        x, quantization.min.x, quantization.max.x, quantized_x);
+    datastructure::quantize(
+        y, quantization.min.y, quantization.max.y, quantized_y);
+
+    auto header = PointSetHeader{};
+    header.scalar_type = ScalarType::unorm16;
+    header.num_points = x.size();
+    header.chunk_size = chunk_size;
+
+    // Quantization is monotonic, so the extreme quantized values decode to
+    // the bounds of the dequantized points
+    auto const step = (quantization.max - quantization.min) /
+                      datastructure::Quantization::max_value;
+    auto const chunks = chunk_bounds(
+        std::span<std::uint16_t const>{ quantized_x },
+        std::span<std::uint16_t const>{ quantized_y },
+        chunk_size,
+        [&](std::uint16_t const value, Axis const axis)
+        {
+            auto const i = static_cast<glm::length_t>(axis);
+            return quantization.min[i] + static_cast<float>(value) * step[i];
+        });
+
+    auto const rectangle = ChunkBounds{
+        .min = { quantization.min.x, quantization.min.y },
+        .max = { quantization.max.x, quantization.max.y },
+    };
+
+    write_sections(path,
+                   header,
+                   std::as_bytes(std::span{ quantized_x }),
+                   std::as_bytes(std::span{ quantized_y }),
+                   chunks,
+                   &rectangle);
+}
+
+void
+write_point_set(std::filesystem::path const& path,
+                std::span<glm::vec2 const> const points,
+                std::size_t const chunk_size)
+{
+    auto x = std::vector<float>(points.size());
+    auto y = std::vector<float>(points.size());
+
+    std::ranges::transform(
+        points, x.begin(), [](glm::vec2 const p) { return p.x; });
+    std::ranges::transform(
+        points, y.begin(), [](glm::vec2 const p) { return p.y; });
+
+    write_point_set<float>(path, x, y, chunk_size);
+}
+
+} // namespace pa093::io
@@ -0,0 +1,243 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <pa093/datastructure/quantization.hpp>
+#include <pa093/io/mapped_file.hpp>
+
+namespace pa093::io
+{
+
+/**
+ * Binary point set format
+ *
+ * A 64 byte header is followed by the x column, the y column and an optional
+ * chunk index, each starting at a multiple of column_alignment. Columns hold
+ * num_points scalars of the header's scalar type; the chunk index holds the
+ * bounding box of every chunk_size consecutive points (the last chunk may be
+ * shorter). All values are little-endian.
+ *
+ * unorm16 columns hold coordinates quantized over the rectangle stored at
+ * the quantization offset (see datastructure::Quantization), at half the
+ * size of float32 columns.
+ */
+enum class ScalarType : std::uint32_t
+{
+    float32 = 0u,
+    float64 = 1u,
+    unorm16 = 2u,
+};
+
+inline constexpr auto point_set_magic =
+    std::array{ 'P', 'A', '0', '9', '3', 'P', 'T', 'S' };
+inline constexpr auto point_set_format_version = std::uint32_t{ 1 };
+inline constexpr auto column_alignment = std::size_t{ 64 };
+inline constexpr auto default_chunk_size = std::size_t{ 65'536 };
+
+struct PointSetHeader
+{
+    std::array<char, 8> magic = point_set_magic;
+    std::uint32_t format_version = point_set_format_version;
+    ScalarType scalar_type = ScalarType::float32;
+    std::uint64_t num_points = 0u;
+    /** Points per chunk of the chunk index; 0 if there is no index */
+    std::uint64_t chunk_size = 0u;
+    std::uint64_t x_offset = 0u;
+    std::uint64_t y_offset = 0u;
+    std::uint64_t chunk_index_offset = 0u;
+    /** Offset of the quantization rectangle; 0 unless the type is unorm16 */
+    std::uint64_t quantization_offset = 0u;
+};
+
+static_assert(sizeof(PointSetHeader) == 64u);
+
+struct ChunkBounds
+{
+    std::array<double, 2> min;
+    std::array<double, 2> max;
+};
+
+enum class Axis
+{
+    x = 0,
+    y = 1,
+};
+
+/**
+ * Returns whether the bytes start with the point set magic
+ */
+[[nodiscard]] auto
+is_point_set(std::span<std::byte const> bytes) noexcept -> bool;
+
+/**
+ * Memory mapped binary point set. Columns are exposed in place; nothing is
+ * copied on load.
+ */
+class PointSetFile
+{
+public:
+    /**
+     * Throws std::runtime_error if the file cannot be mapped or is not a
+     * valid point set.
+     */
+    [[nodiscard]] explicit PointSetFile(std::filesystem::path const& path);
+
+    /**
+     * Takes over an already mapped file, e.g. one checked with
+     * is_point_set(); the path only names the file in errors.
+     */
+    [[nodiscard]] PointSetFile(MappedFile file,
+                               std::filesystem::path const& path);
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t
+    {
+        return static_cast<std::size_t>(header_.num_points);
+    }
+
+    [[nodiscard]] auto scalar_type() const noexcept -> ScalarType
+    {
+        return header_.scalar_type;
+    }
+
+    /**
+     * Column of coordinates, quantized for unorm16. Throws std::logic_error
+     * if T does not match scalar_type().
+     */
+    template<typename T>
+    requires std::same_as<T, float> or std::same_as<T, double> or
+             std::same_as<T, std::uint16_t>
+    [[nodiscard]] auto column(Axis const axis) const -> std::span<T const>
+    {
+        constexpr auto type = std::same_as<T, float>    ? ScalarType::float32
+                              : std::same_as<T, double> ? ScalarType::float64
+                                                        : ScalarType::unorm16;
+        if (type != scalar_type())
+        {
+            throw std::logic_error{ "Point set column type mismatch" };
+        }
+
+        if constexpr (std::same_as<T, float>)
+        {
+            return axis == Axis::x ? float_x_ : float_y_;
+        }
+        else if constexpr (std::same_as<T, double>)
+        {
+            return axis == Axis::x ? double_x_ : double_y_;
+        }
+        else
+        {
+            return axis == Axis::x ? unorm16_x_ : unorm16_y_;
+        }
+    }
+
+    /**
+     * Rectangle the unorm16 columns are quantized over
+     */
+    [[nodiscard]] auto quantization() const noexcept
+        -> datastructure::Quantization const&
+    {
+        return quantization_;
+    }
+
+    [[nodiscard]] auto point(std::size_t const i) const noexcept -> glm::vec2
+    {
+        switch (scalar_type())
+        {
+            case ScalarType::float32:
+                break;
+            case ScalarType::float64:
+                return { static_cast<float>(double_x_[i]),
+                         static_cast<float>(double_y_[i]) };
+            case ScalarType::unorm16:
+                return quantization_.min +
+                       glm::vec2(unorm16_x_[i], unorm16_y_[i]) *
+                           quantization_step_;
+        }
+
+        return { float_x_[i], float_y_[i] };
+    }
+
+    /**
+     * Random access view of the points, converted on access
+     */
+    [[nodiscard]] auto points() const noexcept
+        -> std::ranges::random_access_range auto
+    {
+        return std::views::iota(std::size_t{ 0 }, size()) |
+               std::views::transform([this](std::size_t const i)
+                                     { return point(i); });
+    }
+
+    [[nodiscard]] auto chunk_size() const noexcept -> std::size_t
+    {
+        return static_cast<std::size_t>(header_.chunk_size);
+    }
+
+    /**
+     * Bounding boxes of consecutive chunk_size() points; empty if the file
+     * has no chunk index.
+     */
+    [[nodiscard]] auto chunks() const noexcept -> std::span<ChunkBounds const>
+    {
+        return chunks_;
+    }
+
+private:
+    MappedFile file_;
+    PointSetHeader header_;
+    std::span<float const> float_x_;
+    std::span<float const> float_y_;
+    std::span<double const> double_x_;
+    std::span<double const> double_y_;
+    std::span<std::uint16_t const> unorm16_x_;
+    std::span<std::uint16_t const> unorm16_y_;
+    datastructure::Quantization quantization_;
+    glm::vec2 quantization_step_ = {};
+    std::span<ChunkBounds const> chunks_;
+};
+
+/**
+ * Writes a point set from coordinate columns of equal size, with a chunk
+ * index if chunk_size is not 0.
+ *
+ * Throws std::runtime_error if the file cannot be written.
+ */
+template<typename T>
+requires std::same_as<T, float> or std::same_as<T, double>
+void
+write_point_set(std::filesystem::path const& path,
+                std::span<T const> x,
+                std::span<T const> y,
+                std::size_t chunk_size = default_chunk_size);
+
+/**
+ * Writes a unorm16 point set, quantized over the bounding rectangle of the
+ * columns. The chunk index bounds the dequantized points.
+ *
+ * Throws std::runtime_error if the file cannot be written.
+ */
+void
+write_quantized_point_set(std::filesystem::path const& path,
+                          std::span<float const> x,
+                          std::span<float const> y,
+                          std::size_t chunk_size = default_chunk_size);
+
+/**
+ * Writes points as a float32 point set
+ */
+void
+write_point_set(std::filesystem::path const& path,
+                std::span<glm::vec2 const> points,
+                std::size_t chunk_size = default_chunk_size);
+
+} // namespace pa093::io
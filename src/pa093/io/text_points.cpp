@@ -0,0 +1,323 @@
+#include <pa093/io/text_points.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <pa093/concurrency/parallel_for.hpp>
+
+namespace pa093::io
+{
+
+namespace
+{
+
+constexpr auto min_bytes_per_thread = std::size_t{ 1 } << 20u;
+
+[[nodiscard]] constexpr auto
+is_blank(char const c) noexcept -> bool
+{
+    return c == ' ' or c == '\t' or c == '\r';
+}
+
+[[nodiscard]] constexpr auto
+starts_number(char const c) noexcept -> bool
+{
+    return (c >= '0' and c <= '9') or c == '+' or c == '-' or c == '.';
+}
+
+/**
+ * Returns whether a number std::from_chars found out of range is too small
+ * rather than too large, i.e. whether its magnitude is below 1
+ */
+[[nodiscard]] auto
+is_underflow(char const* first, char const* const last) noexcept -> bool
+{
+    if (first != last and *first == '-')
+    {
+        ++first;
+    }
+
+    // Decimal exponent of the leading digit, plus one
+    auto magnitude = std::int64_t{ 0 };
+    auto leading_zero = true;
+    auto fraction = false;
+    for (; first != last and *first != 'e' and *first != 'E'; ++first)
+    {
+        if (*first == '.')
+        {
+            fraction = true;
+        }
+        else if (leading_zero and *first == '0')
+        {
+            magnitude -= fraction ? 1 : 0;
+        }
+        else
+        {
+            leading_zero = false;
+            magnitude += fraction ? 0 : 1;
+        }
+    }
+
+    if (first == last)
+    {
+        return magnitude <= 0;
+    }
+
+    ++first;
+    auto const negative = first != last and *first == '-';
+    if (first != last and *first == '+')
+    {
+        ++first;
+    }
+
+    auto exponent = std::int64_t{ 0 };
+    if (std::from_chars(first, last, exponent).ec != std::errc{})
+    {
+        // The exponent alone is out of range
+        return negative;
+    }
+
+    return magnitude + exponent <= 0;
+}
+
+/**
+ * Parses a coordinate like std::from_chars, but also accepts a leading '+'
+ * and flushes values too small for T to zero. Returns the end of the
+ * coordinate, or nullptr if there is none.
+ */
+template<typename T>
+[[nodiscard]] auto
+parse_coordinate(char const* first, char const* const last, T& value) noexcept
+    -> char const*
+{
+    if (first != last and *first == '+')
+    {
+        ++first;
+        if (first != last and *first == '-')
+        {
+            return nullptr;
+        }
+    }
+
+    auto const [end, error] = std::from_chars(first, last, value);
+    if (error == std::errc::result_out_of_range and is_underflow(first, end))
+    {
+        value = T{};
+        return end;
+    }
+
+    return error == std::errc{} ? end : nullptr;
+}
+
+template<typename T>
+struct ChunkResult
+{
+    PointColumns<T> columns;
+    /** Offset of the first malformed line */
+    std::optional<std::size_t> error;
+};
+
+/**
+ * Parses the lines starting in [begin, end) of text
+ */
+template<typename T>
+void
+parse_lines(std::string_view const text,
+            std::size_t begin,
+            std::size_t const end,
+            ChunkResult<T>& result)
+{
+    // Lines are owned by the chunk they start in
+    if (begin != 0u and text[begin - 1u] != '\n')
+    {
+        auto const newline = text.find('\n', begin);
+        begin = newline == std::string_view::npos ? text.size() : newline + 1u;
+    }
+
+    auto const* const data = text.data();
+    auto pos = begin;
+    // Only the first point line of the text may be a header
+    auto header_allowed = begin == 0u;
+
+    while (pos < end)
+    {
+        auto const line_begin = pos;
+        auto const newline = text.find('\n', pos);
+        auto const line_end =
+            newline == std::string_view::npos ? text.size() : newline;
+        pos = line_end + 1u;
+
+        auto p = line_begin;
+        while (p < line_end and is_blank(data[p]))
+        {
+            ++p;
+        }
+        if (p == line_end or data[p] == '#')
+        {
+            continue;
+        }
+
+        auto x = T{};
+        auto y = T{};
+
+        auto const* const x_end =
+            parse_coordinate(data + p, data + line_end, x);
+        if (x_end == nullptr and header_allowed and
+            not starts_number(data[p]))
+        {
+            // A header such as "x,y"
+            header_allowed = false;
+            continue;
+        }
+        header_allowed = false;
+
+        auto const* y_end = static_cast<char const*>(nullptr);
+        if (x_end != nullptr)
+        {
+            p = static_cast<std::size_t>(x_end - data);
+            while (p < line_end and (is_blank(data[p]) or data[p] == ','))
+            {
+                ++p;
+            }
+            y_end = parse_coordinate(data + p, data + line_end, y);
+        }
+
+        if (y_end != nullptr)
+        {
+            p = static_cast<std::size_t>(y_end - data);
+            while (p < line_end and is_blank(data[p]))
+            {
+                ++p;
+            }
+        }
+
+        if (y_end == nullptr or p != line_end)
+        {
+            result.error = line_begin;
+            return;
+        }
+
+        result.columns.x.push_back(x);
+        result.columns.y.push_back(y);
+    }
+}
+
+} // namespace
+
+template<typename T>
+requires std::same_as<T, float> or std::same_as<T, double>
+auto
+parse_text_points(std::string_view const text) -> PointColumns<T>
+{
+    auto chunks = std::vector<ChunkResult<T>>(concurrency::max_chunk_count());
+
+    auto const num_chunks = concurrency::parallel_for_chunks(
+        text.size(),
+        [&](std::size_t const chunk,
+            std::size_t const begin,
+            std::size_t const end)
+        {
+            // Rough estimate of 20 bytes per line
+            chunks[chunk].columns.x.reserve((end - begin) / 20u);
+            chunks[chunk].columns.y.reserve((end - begin) / 20u);
+            parse_lines(text, begin, end, chunks[chunk]);
+        },
+        min_bytes_per_thread);
+
+    chunks.resize(num_chunks);
+
+    auto total = std::size_t{ 0 };
+    for (auto const& chunk : chunks)
+    {
+        if (chunk.error)
+        {
+            auto const line = 1 + std::count(text.begin(),
+                                             text.begin() + *chunk.error,
+                                             '\n');
+            throw std::runtime_error{ fmt::format(
+                "Line {}: expected two coordinates", line) };
+        }
+
+        total += chunk.columns.x.size();
+    }
+
+    if (chunks.size() == 1u)
+    {
+        return std::move(chunks.front().columns);
+    }
+
+    auto columns = PointColumns<T>{};
+    columns.x.reserve(total);
+    columns.y.reserve(total);
+
+    for (auto const& chunk : chunks)
+    {
+        columns.x.insert(
+            columns.x.end(), chunk.columns.x.begin(), chunk.columns.x.end());
+        columns.y.insert(
+            columns.y.end(), chunk.columns.y.begin(), chunk.columns.y.end());
+    }
+
+    return columns;
+}
+
+template<typename T>
+requires std::same_as<T, float> or std::same_as<T, double>
+auto
+read_text_points(std::filesystem::path const& path) -> PointColumns<T>
+{
+    return read_text_points<T>(MappedFile{ path }, path);
+}
+
+template<typename T>
+requires std::same_as<T, float> or std::same_as<T, double>
+auto
+read_text_points(MappedFile const& file, std::filesystem::path const& path)
+    -> PointColumns<T>
+{
+    auto const bytes = file.bytes();
+
+    try
+    {
+        return parse_text_points<T>(
+            { reinterpret_cast<char const*>(bytes.data()), bytes.size() });
+    }
+    catch (std::runtime_error const& error)
+    {
+        throw std::runtime_error{ fmt::format(
+            "{}: {}", path.string(), error.what()) };
+    }
+}
+
+template auto
+parse_text_points<float>(std::string_view text) -> PointColumns<float>;
+
+template auto
+parse_text_points<double>(std::string_view text) -> PointColumns<double>;
+
+template auto
+read_text_points<float>(std::filesystem::path const& path)
+    -> PointColumns<float>;
+
+template auto
+read_text_points<double>(std::filesystem::path const& path)
+    -> PointColumns<double>;
+
+template auto
+read_text_points<float>(MappedFile const& file,
+                        std::filesystem::path const& path)
+    -> PointColumns<float>;
+
+template auto
+read_text_points<double>(MappedFile const& file,
+                         std::filesystem::path const& path)
+    -> PointColumns<double>;
+
+} // namespace pa093::io
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <concepts>
+#include <filesystem>
+#include <string_view>
+#include <vector>
+
+#include <pa093/io/mapped_file.hpp>
+
+namespace pa093::io
+{
+
+template<typename T>
+struct PointColumns
+{
+    std::vector<T> x;
+    std::vector<T> y;
+};
+
+/**
+ * Parses text points: one point per line as two coordinates separated by
+ * whitespace and/or a comma (so plain CSV works). Empty lines and lines
+ * starting with '#' are skipped, as is a first line that does not start with
+ * a number, such as a CSV header. Coordinates may have a leading '+';
+ * coordinates too small to represent in T are read as 0. Large inputs are
+ * parsed in parallel, one range of lines per thread.
+ *
+ * Throws std::runtime_error naming the line of the first malformed point.
+ */
+template<typename T>
+requires std::same_as<T, float> or std::same_as<T, double>
+[[nodiscard]] auto
+parse_text_points(std::string_view text) -> PointColumns<T>;
+
+/**
+ * Maps a text point file and parses it with parse_text_points()
+ */
+template<typename T>
+requires std::same_as<T, float> or std::same_as<T, double>
+[[nodiscard]] auto
+read_text_points(std::filesystem::path const& path) -> PointColumns<T>;
+
+/**
+ * Parses an already mapped text point file; the path only names the file in
+ * errors.
+ */
+template<typename T>
+requires std::same_as<T, float> or std::same_as<T, double>
+[[nodiscard]] auto
+read_text_points(MappedFile const& file, std::filesystem::path const& path)
+    -> PointColumns<T>;
+
+} // namespace pa093::io
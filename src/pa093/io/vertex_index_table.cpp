@@ -0,0 +1,118 @@
+#include <pa093/io/vertex_index_table.hpp>
+
+#include <algorithm>
+#include <bit>
+
+#include <gsl/gsl_assert>
+
+namespace pa093::io
+{
+
+namespace
+{
+
+[[nodiscard]] auto
+vertex_key(glm::vec2 const vertex) noexcept -> std::uint64_t
+{
+    return std::uint64_t{ std::bit_cast<std::uint32_t>(vertex.x) } << 32u |
+           std::bit_cast<std::uint32_t>(vertex.y);
+}
+
+} // namespace
+
+VertexIndexTable::VertexIndexTable(std::size_t const expected_size)
+{
+    if (expected_size > 0u)
+    {
+        rehash(capacity_for(expected_size));
+    }
+}
+
+auto
+VertexIndexTable::try_emplace(glm::vec2 const vertex, index_type const index)
+    -> std::pair<index_type, bool>
+{
+    Expects(index != empty_index);
+
+    if ((size_ + 1u) * max_load_denominator >
+        indices_.size() * max_load_numerator)
+    {
+        rehash(capacity_for(size_ + 1u));
+    }
+
+    auto const key = vertex_key(vertex);
+    auto const mask = indices_.size() - 1u;
+
+    for (auto s = slot(key);; s = (s + 1u) & mask)
+    {
+        if (indices_[s] == empty_index)
+        {
+            keys_[s] = key;
+            indices_[s] = index;
+            ++size_;
+            return { index, true };
+        }
+        if (keys_[s] == key)
+        {
+            return { indices_[s], false };
+        }
+    }
+}
+
+void
+VertexIndexTable::clear() noexcept
+{
+    keys_ = {};
+    indices_ = {};
+    size_ = 0u;
+    shift_ = 64u;
+}
+
+auto
+VertexIndexTable::capacity_for(std::size_t const size) noexcept -> std::size_t
+{
+    return std::bit_ceil(std::max(
+        min_capacity, size * max_load_denominator / max_load_numerator + 1u));
+}
+
+auto
+VertexIndexTable::slot(std::uint64_t key) const noexcept -> std::size_t
+{
+    // Nearby vertices differ mostly in the low bits of their coordinates;
+    // mix them into the top bits (MurmurHash3 finalizer)
+    key ^= key >> 33u;
+    key *= 0xFF51AFD7ED558CCDu;
+    key ^= key >> 33u;
+    key *= 0xC4CEB9FE1A85EC53u;
+    key ^= key >> 33u;
+
+    return static_cast<std::size_t>(key >> shift_);
+}
+
+void
+VertexIndexTable::rehash(std::size_t const capacity)
+{
+    auto old_keys = std::exchange(keys_, std::vector<std::uint64_t>(capacity));
+    auto old_indices =
+        std::exchange(indices_, std::vector<index_type>(capacity, empty_index));
+    shift_ = 64u - static_cast<unsigned>(std::countr_zero(capacity));
+
+    auto const mask = capacity - 1u;
+    for (auto i = std::size_t{ 0 }; i < old_indices.size(); ++i)
+    {
+        if (old_indices[i] == empty_index)
+        {
+            continue;
+        }
+
+        auto s = slot(old_keys[i]);
+        while (indices_[s] != empty_index)
+        {
+            s = (s + 1u) & mask;
+        }
+        keys_[s] = old_keys[i];
+        indices_[s] = old_indices[i];
+    }
+}
+
+} // namespace pa093::io
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace pa093::io
+{
+
+/**
+ * Indices of distinct vertices, keyed by the exact bits of their
+ * coordinates.
+ *
+ * An open-addressing table with linear probing in two flat arrays, taking
+ * 12 bytes per slot with no per-entry allocation, instead of the node and
+ * bucket overhead of std::unordered_map. Sized up front from the expected
+ * number of vertices, so that it grows only if that is exceeded.
+ */
+class VertexIndexTable
+{
+public:
+    using index_type = std::uint32_t;
+
+    /**
+     * Reserved to mark empty slots
+     */
+    static constexpr auto empty_index = ~index_type{ 0 };
+
+    explicit VertexIndexTable(std::size_t expected_size = 0u);
+
+    /**
+     * Returns the index of the vertex and false if it is already present,
+     * otherwise inserts it with the given index and returns that and true
+     */
+    auto try_emplace(glm::vec2 vertex, index_type index)
+        -> std::pair<index_type, bool>;
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return size_; }
+
+    /**
+     * Removes all vertices and frees the memory
+     */
+    void clear() noexcept;
+
+private:
+    /**
+     * Largest load factor, as a fraction; probe sequences stay short below
+     * it
+     */
+    static constexpr auto max_load_numerator = std::size_t{ 3 };
+    static constexpr auto max_load_denominator = std::size_t{ 4 };
+    static constexpr auto min_capacity = std::size_t{ 16 };
+
+    std::vector<std::uint64_t> keys_;
+    std::vector<index_type> indices_;
+    std::size_t size_ = 0u;
+    // Hashes are reduced to slots by their top bits
+    unsigned shift_ = 64u;
+
+    /**
+     * Smallest capacity, a power of two, that holds the number of vertices
+     * below the maximum load factor
+     */
+    [[nodiscard]] static auto capacity_for(std::size_t size) noexcept
+        -> std::size_t;
+
+    [[nodiscard]] auto slot(std::uint64_t key) const noexcept -> std::size_t;
+
+    void rehash(std::size_t capacity);
+};
+
+} // namespace pa093::io
@@ -7,10 +7,12 @@
 #include <glpp/glfw/glfw.hpp>
 #include <glpp/glfw/window.hpp>
 #include <glpp/imgui/imgui.hpp>
+#include <GLFW/glfw3.h>
 #include <imgui.h>
 #include <spdlog/spdlog.h>
 
 #include <pa093/app.hpp>
+#include <pa093/profiling/profiler.hpp>
 
 namespace
 {
@@ -19,6 +21,12 @@ inline constexpr auto min_frame_duration =
     std::chrono::duration_cast<std::chrono::steady_clock::duration>(
         std::chrono::duration<float>{ 1.0f } / 60.0f);
 
+/**
+ * Frames drawn after the last wake up before waiting for events again, so
+ * that the GUI can settle the hover and focus state changed by the input
+ */
+inline constexpr auto settle_frame_count = 3;
+
 }
 
 auto
@@ -42,19 +50,38 @@ main() -> int
         ImGui::StyleColorsClassic();
 
         auto frame_start = std::chrono::steady_clock::now();
+        auto frames_to_settle = settle_frame_count;
 
         while (not window.should_close())
         {
-            glpp::clear_color({ 0.0f, 0.0f, 0.0f, 1.0f });
-            window.poll_events();
-            imgui.new_frame();
+            // Sleep until input arrives or the scene worker publishes new
+            // geometry
+            if (frames_to_settle == 0 and not app.redraw_continuously())
+            {
+                glfwWaitEvents();
+                frames_to_settle = settle_frame_count;
+            }
+
+            {
+                PA093_PROFILE_SCOPE("Frame");
 
-            app.draw_gui();
-            app.update();
-            app.draw_scene();
+                glpp::clear_color({ 0.0f, 0.0f, 0.0f, 1.0f });
+                window.poll_events();
+                imgui.new_frame();
 
-            imgui.render();
-            window.swap_buffers();
+                app.draw_gui();
+                app.update();
+                app.draw_scene();
+
+                imgui.render();
+                window.swap_buffers();
+            }
+            PA093_PROFILE_FRAME();
+
+            if (frames_to_settle > 0)
+            {
+                --frames_to_settle;
+            }
 
             // Check frame duration and sleep if necessary
             auto frame_end = std::chrono::steady_clock::now();
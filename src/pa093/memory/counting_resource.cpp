@@ -0,0 +1,34 @@
+#include <pa093/memory/counting_resource.hpp>
+
+namespace pa093::memory
+{
+
+auto
+CountingResource::do_allocate(std::size_t const bytes,
+                              std::size_t const alignment) -> void*
+{
+    auto* const ptr = upstream_->allocate(bytes, alignment);
+
+    allocations_.fetch_add(1u, std::memory_order_relaxed);
+    bytes_in_use_.fetch_add(bytes, std::memory_order_relaxed);
+
+    return ptr;
+}
+
+void
+CountingResource::do_deallocate(void* const ptr,
+                                std::size_t const bytes,
+                                std::size_t const alignment)
+{
+    upstream_->deallocate(ptr, bytes, alignment);
+    bytes_in_use_.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+auto
+CountingResource::do_is_equal(
+    std::pmr::memory_resource const& other) const noexcept -> bool
+{
+    return this == &other;
+}
+
+} // namespace pa093::memory
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+namespace pa093::memory
+{
+
+/**
+ * Memory resource that forwards to an upstream resource and counts the
+ * allocations passing through it. Thread safe if the upstream resource is.
+ */
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+    [[nodiscard]] explicit CountingResource(
+        std::pmr::memory_resource* const upstream =
+            std::pmr::get_default_resource()) noexcept
+        : upstream_{ upstream }
+    {
+    }
+
+    /**
+     * Number of allocations since construction
+     */
+    [[nodiscard]] auto allocations() const noexcept -> std::uint64_t
+    {
+        return allocations_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Bytes currently allocated
+     */
+    [[nodiscard]] auto bytes_in_use() const noexcept -> std::uint64_t
+    {
+        return bytes_in_use_.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::pmr::memory_resource* upstream_;
+    std::atomic<std::uint64_t> allocations_ = 0u;
+    std::atomic<std::uint64_t> bytes_in_use_ = 0u;
+
+    auto do_allocate(std::size_t bytes, std::size_t alignment)
+        -> void* override;
+
+    void do_deallocate(void* ptr,
+                       std::size_t bytes,
+                       std::size_t alignment) override;
+
+    [[nodiscard]] auto do_is_equal(
+        std::pmr::memory_resource const& other) const noexcept
+        -> bool override;
+};
+
+} // namespace pa093::memory
@@ -0,0 +1,34 @@
+#include <pa093/memory/frame_arena.hpp>
+
+#include <algorithm>
+
+namespace pa093::memory
+{
+
+FrameArena::FrameArena(std::size_t const capacity,
+                       std::pmr::memory_resource* const upstream)
+    : upstream_{ upstream }
+    , capacity_{ std::max(capacity, std::size_t{ 1 }) }
+    , buffer_{ std::make_unique_for_overwrite<std::byte[]>(capacity_) }
+{
+    arena_.emplace(buffer_.get(), capacity_, &upstream_);
+}
+
+void
+FrameArena::reset()
+{
+    // Bytes the frame needed beyond the buffer, still held by the arena
+    auto const overflow = static_cast<std::size_t>(upstream_.bytes_in_use());
+
+    arena_.reset();
+
+    if (overflow > 0u)
+    {
+        capacity_ = std::max(capacity_ * 2u, capacity_ + overflow);
+        buffer_ = std::make_unique_for_overwrite<std::byte[]>(capacity_);
+    }
+
+    arena_.emplace(buffer_.get(), capacity_, &upstream_);
+}
+
+} // namespace pa093::memory
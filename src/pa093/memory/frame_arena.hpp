@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+
+#include <pa093/memory/counting_resource.hpp>
+
+namespace pa093::memory
+{
+
+/**
+ * Monotonic arena for allocations that live no longer than a frame.
+ *
+ * Allocations are bumped from one buffer and never freed individually;
+ * reset() frees everything at once. A frame that outgrows the buffer is
+ * served from upstream, and the buffer grows at the next reset() to cover
+ * it, so frames of a steady size do not touch the heap at all.
+ *
+ * Not thread safe.
+ */
+class FrameArena
+{
+public:
+    static constexpr auto default_capacity = std::size_t{ 64 } << 10u;
+
+    [[nodiscard]] explicit FrameArena(
+        std::size_t capacity = default_capacity,
+        std::pmr::memory_resource* upstream =
+            std::pmr::get_default_resource());
+
+    FrameArena(FrameArena const&) = delete;
+    auto operator=(FrameArena const&) -> FrameArena& = delete;
+
+    [[nodiscard]] auto resource() noexcept -> std::pmr::memory_resource*
+    {
+        return &*arena_;
+    }
+
+    /**
+     * Frees all allocations made since the last reset. Everything allocated
+     * from resource() must be destroyed before.
+     */
+    void reset();
+
+    [[nodiscard]] auto capacity() const noexcept -> std::size_t
+    {
+        return capacity_;
+    }
+
+    /**
+     * Number of upstream allocations made so far by frames that outgrew
+     * the buffer; stops increasing once the buffer fits a frame
+     */
+    [[nodiscard]] auto upstream_allocations() const noexcept -> std::uint64_t
+    {
+        return upstream_.allocations();
+    }
+
+private:
+    CountingResource upstream_;
+    std::size_t capacity_;
+    std::unique_ptr<std::byte[]> buffer_;
+    std::optional<std::pmr::monotonic_buffer_resource> arena_;
+};
+
+} // namespace pa093::memory
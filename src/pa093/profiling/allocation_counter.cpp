@@ -0,0 +1,27 @@
+#include <pa093/profiling/allocation_counter.hpp>
+
+#include <atomic>
+
+namespace pa093::profiling
+{
+
+namespace
+{
+
+std::atomic<std::uint64_t> allocations{ 0u };
+
+} // namespace
+
+auto
+allocation_count() noexcept -> std::uint64_t
+{
+    return allocations.load(std::memory_order_relaxed);
+}
+
+void
+count_allocation() noexcept
+{
+    allocations.fetch_add(1u, std::memory_order_relaxed);
+}
+
+} // namespace pa093::profiling
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+
+namespace pa093::profiling
+{
+
+/**
+ * Number of global operator new calls since startup.
+ *
+ * Only counted in executables that link the replacement allocation
+ * functions of counting_operator_new.cpp, i.e. the interactive application
+ * with profiling enabled; otherwise this always returns 0. The benchmarks
+ * and the command line tool thus do not pay for a counter shared by all
+ * threads on every allocation.
+ */
+[[nodiscard]] auto allocation_count() noexcept -> std::uint64_t;
+
+/**
+ * Called by the replacement allocation functions
+ */
+void count_allocation() noexcept;
+
+} // namespace pa093::profiling
@@ -0,0 +1,104 @@
+#include <pa093/profiling/allocation_counter.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+
+/**
+ * Retries through the new-handler until the allocation succeeds, as
+ * required of the replaceable allocation functions
+ */
+template<typename F>
+[[nodiscard]] auto
+allocate(F const& try_allocate) -> void*
+{
+    pa093::profiling::count_allocation();
+
+    while (true)
+    {
+        if (auto* const ptr = try_allocate())
+        {
+            return ptr;
+        }
+
+        auto const handler = std::get_new_handler();
+        if (not handler)
+        {
+            throw std::bad_alloc{};
+        }
+        handler();
+    }
+}
+
+[[nodiscard]] auto
+aligned_malloc(std::size_t const size, std::size_t const alignment) noexcept
+    -> void*
+{
+#ifdef _WIN32
+    return _aligned_malloc(size, alignment);
+#else
+    // The size must be a multiple of the alignment, a power of two
+    auto const aligned_size = (size + alignment - 1u) & ~(alignment - 1u);
+    return std::aligned_alloc(alignment, aligned_size);
+#endif
+}
+
+void
+aligned_free(void* const ptr) noexcept
+{
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+} // namespace
+
+// Replacements counting every allocation for allocation_count(). The
+// remaining forms (array, nothrow) forward to these by default.
+
+auto
+operator new(std::size_t const size) -> void*
+{
+    return allocate([&] { return std::malloc(size == 0u ? 1u : size); });
+}
+
+auto
+operator new(std::size_t const size, std::align_val_t const alignment)
+    -> void*
+{
+    return allocate(
+        [&]
+        {
+            return aligned_malloc(size == 0u ? 1u : size,
+                                  static_cast<std::size_t>(alignment));
+        });
+}
+
+void
+operator delete(void* const ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void
+operator delete(void* const ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void
+operator delete(void* const ptr, std::align_val_t) noexcept
+{
+    aligned_free(ptr);
+}
+
+void
+operator delete(void* const ptr, std::size_t, std::align_val_t) noexcept
+{
+    aligned_free(ptr);
+}
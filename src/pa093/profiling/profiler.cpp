@@ -0,0 +1,314 @@
+#include <pa093/profiling/profiler.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <pa093/profiling/allocation_counter.hpp>
+
+namespace pa093::profiling
+{
+
+namespace
+{
+
+/**
+ * Small dense id of the calling thread, used as the trace "tid"
+ */
+auto
+thread_id() -> std::uint32_t
+{
+    static auto next_id = std::atomic<std::uint32_t>{ 1u };
+    thread_local auto const id = next_id.fetch_add(1u);
+    return id;
+}
+
+auto
+escape_json(std::string_view const text) -> std::string
+{
+    auto result = std::string{};
+    result.reserve(text.size());
+
+    for (auto const c : text)
+    {
+        if (c == '"' or c == '\\')
+        {
+            result.push_back('\\');
+            result.push_back(c);
+        }
+        else if (static_cast<unsigned char>(c) < 0x20u)
+        {
+            fmt::format_to(std::back_inserter(result),
+                           "\\u{:04x}",
+                           static_cast<unsigned>(c));
+        }
+        else
+        {
+            result.push_back(c);
+        }
+    }
+
+    return result;
+}
+
+} // namespace
+
+auto
+Profiler::instance() -> Profiler&
+{
+    static auto profiler = Profiler{};
+    return profiler;
+}
+
+void
+Profiler::record(std::string_view const name,
+                 clock_type::time_point const begin,
+                 clock_type::time_point const end)
+{
+    auto const duration_ms =
+        std::chrono::duration<float, std::milli>{ end - begin }.count();
+
+    auto const lock = std::scoped_lock{ mutex_ };
+
+    auto& s = stage(name);
+    ++s.calls;
+    s.frame_ms += duration_ms;
+
+    if (tracing_)
+    {
+        add_trace_event({
+            .name = name,
+            .thread_id = thread_id(),
+            .begin_ns = since_epoch(begin),
+            .duration_ns = since_epoch(end) - since_epoch(begin),
+        });
+    }
+}
+
+void
+Profiler::set_counter(std::string_view const name, double const value)
+{
+    auto const now = clock_type::now();
+    auto const lock = std::scoped_lock{ mutex_ };
+
+    if (auto const it = std::ranges::find(counters_, name, &CounterValue::name);
+        it != counters_.end())
+    {
+        if (it->value == value)
+        {
+            return;
+        }
+        it->value = value;
+    }
+    else
+    {
+        counters_.push_back({ name, value });
+    }
+
+    if (tracing_)
+    {
+        add_trace_event({
+            .name = name,
+            .thread_id = thread_id(),
+            .begin_ns = since_epoch(now),
+            .value = value,
+            .counter = true,
+        });
+    }
+}
+
+void
+Profiler::end_frame()
+{
+    auto const allocations = allocation_count();
+    auto const lock = std::scoped_lock{ mutex_ };
+
+    for (auto& s : stages_)
+    {
+        s.history_head = (s.history_head + 1u) % history_size;
+        s.history_ms[s.history_head] = s.frame_ms;
+        s.frame_ms = 0.0f;
+    }
+
+    frame_allocations_ = allocations - frame_start_allocations_;
+    frame_start_allocations_ = allocations;
+}
+
+auto
+Profiler::stages(std::pmr::memory_resource* const resource) const
+    -> std::pmr::vector<StageStats>
+{
+    auto const lock = std::scoped_lock{ mutex_ };
+
+    auto result = std::pmr::vector<StageStats>{ resource };
+    result.reserve(stages_.size());
+
+    for (auto const& s : stages_)
+    {
+        auto& stats = result.emplace_back();
+        stats.name = s.name;
+        stats.calls = s.calls;
+        stats.last_ms = s.history_ms[s.history_head];
+        stats.mean_ms =
+            std::accumulate(s.history_ms.begin(), s.history_ms.end(), 0.0f) /
+            static_cast<float>(history_size);
+        stats.max_ms = std::ranges::max(s.history_ms);
+
+        // Oldest first, so the history can be plotted directly
+        std::ranges::rotate_copy(s.history_ms,
+                                 s.history_ms.begin() +
+                                     static_cast<std::ptrdiff_t>(
+                                         (s.history_head + 1u) % history_size),
+                                 stats.history_ms.begin());
+    }
+
+    return result;
+}
+
+auto
+Profiler::counters(std::pmr::memory_resource* const resource) const
+    -> std::pmr::vector<CounterValue>
+{
+    auto const lock = std::scoped_lock{ mutex_ };
+    return { counters_.begin(), counters_.end(), resource };
+}
+
+auto
+Profiler::frame_allocations() const -> std::uint64_t
+{
+    auto const lock = std::scoped_lock{ mutex_ };
+    return frame_allocations_;
+}
+
+void
+Profiler::start_trace()
+{
+    auto const lock = std::scoped_lock{ mutex_ };
+
+    trace_.clear();
+    tracing_ = true;
+
+    // Start every counter track at its current value
+    auto const now = since_epoch(clock_type::now());
+    for (auto const& counter : counters_)
+    {
+        add_trace_event({
+            .name = counter.name,
+            .thread_id = thread_id(),
+            .begin_ns = now,
+            .value = counter.value,
+            .counter = true,
+        });
+    }
+}
+
+auto
+Profiler::stop_trace(std::filesystem::path const& path) -> std::size_t
+{
+    auto events = std::vector<TraceEvent>{};
+    {
+        auto const lock = std::scoped_lock{ mutex_ };
+        tracing_ = false;
+        events.swap(trace_);
+    }
+
+    auto file = std::ofstream{ path, std::ios::binary };
+    if (not file)
+    {
+        throw std::runtime_error{ fmt::format(
+            "Failed to open trace file {}", path.string()) };
+    }
+
+    auto buffer = fmt::memory_buffer{};
+    fmt::format_to(std::back_inserter(buffer), "{{\"traceEvents\":[\n");
+
+    auto const micros = [](std::int64_t const ns)
+    { return static_cast<double>(ns) / 1e3; };
+
+    for (auto first = true; auto const& event : events)
+    {
+        if (not std::exchange(first, false))
+        {
+            fmt::format_to(std::back_inserter(buffer), ",\n");
+        }
+
+        auto const name = escape_json(event.name);
+        if (event.counter)
+        {
+            fmt::format_to(std::back_inserter(buffer),
+                           "{{\"name\":\"{}\",\"ph\":\"C\",\"ts\":{:.3f},"
+                           "\"pid\":1,\"tid\":{},\"args\":{{\"value\":{}}}}}",
+                           name,
+                           micros(event.begin_ns),
+                           event.thread_id,
+                           event.value);
+        }
+        else
+        {
+            fmt::format_to(std::back_inserter(buffer),
+                           "{{\"name\":\"{}\",\"ph\":\"X\",\"ts\":{:.3f},"
+                           "\"dur\":{:.3f},\"pid\":1,\"tid\":{}}}",
+                           name,
+                           micros(event.begin_ns),
+                           micros(event.duration_ns),
+                           event.thread_id);
+        }
+    }
+
+    fmt::format_to(std::back_inserter(buffer),
+                   "\n],\"displayTimeUnit\":\"ms\"}}\n");
+
+    file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    if (not file)
+    {
+        throw std::runtime_error{ fmt::format(
+            "Failed to write trace file {}", path.string()) };
+    }
+
+    return events.size();
+}
+
+auto
+Profiler::tracing() const -> bool
+{
+    auto const lock = std::scoped_lock{ mutex_ };
+    return tracing_;
+}
+
+auto
+Profiler::stage(std::string_view const name) -> Stage&
+{
+    if (auto const it = std::ranges::find(stages_, name, &Stage::name);
+        it != stages_.end())
+    {
+        return *it;
+    }
+
+    return stages_.emplace_back(Stage{ .name = name });
+}
+
+void
+Profiler::add_trace_event(TraceEvent const& event)
+{
+    // Drop events rather than grow without bound during long captures
+    if (trace_.size() < max_trace_events)
+    {
+        trace_.push_back(event);
+    }
+}
+
+auto
+Profiler::since_epoch(clock_type::time_point const time) const -> std::int64_t
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time - epoch_)
+        .count();
+}
+
+} // namespace pa093::profiling
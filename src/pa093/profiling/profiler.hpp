@@ -0,0 +1,181 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory_resource>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+namespace pa093::profiling
+{
+
+/**
+ * Collects timed scopes and counters from any thread.
+ *
+ * Scopes are aggregated per name and per frame into a rolling history for the
+ * in-app overlay. While a trace is being captured, every scope and counter
+ * sample is also kept (up to max_trace_events) so it can be written as a
+ * Chrome trace_event file for chrome://tracing or Perfetto.
+ *
+ * Names must be string literals (or otherwise outlive the profiler); they are
+ * stored and compared by value but never copied.
+ */
+class Profiler
+{
+public:
+    using clock_type = std::chrono::steady_clock;
+
+    static constexpr auto history_size = std::size_t{ 120 };
+    static constexpr auto max_trace_events = std::size_t{ 1 } << 20u;
+
+    struct StageStats
+    {
+        std::string_view name;
+        std::size_t calls = 0u;
+        float last_ms = 0.0f;
+        float mean_ms = 0.0f;
+        float max_ms = 0.0f;
+        std::array<float, history_size> history_ms = {};
+    };
+
+    struct CounterValue
+    {
+        std::string_view name;
+        double value = 0.0;
+    };
+
+    [[nodiscard]] static auto instance() -> Profiler&;
+
+    void record(std::string_view name,
+                clock_type::time_point begin,
+                clock_type::time_point end);
+
+    void set_counter(std::string_view name, double value);
+
+    /**
+     * Closes the current frame: per-stage totals since the previous call
+     * become the newest history entry.
+     */
+    void end_frame();
+
+    /**
+     * Snapshot of the stage statistics, allocated from the resource
+     */
+    [[nodiscard]] auto stages(std::pmr::memory_resource* resource =
+                                  std::pmr::get_default_resource()) const
+        -> std::pmr::vector<StageStats>;
+
+    [[nodiscard]] auto counters(std::pmr::memory_resource* resource =
+                                    std::pmr::get_default_resource()) const
+        -> std::pmr::vector<CounterValue>;
+
+    /**
+     * Heap allocations made during the last completed frame, or 0 in
+     * executables that do not count allocations (see allocation_count()).
+     */
+    [[nodiscard]] auto frame_allocations() const -> std::uint64_t;
+
+    void start_trace();
+
+    /**
+     * Stops capturing and writes the captured events as Chrome trace_event
+     * JSON. Returns the number of events written.
+     */
+    auto stop_trace(std::filesystem::path const& path) -> std::size_t;
+
+    [[nodiscard]] auto tracing() const -> bool;
+
+private:
+    struct Stage
+    {
+        std::string_view name;
+        std::size_t calls = 0u;
+        float frame_ms = 0.0f;
+        std::size_t history_head = 0u;
+        std::array<float, history_size> history_ms = {};
+    };
+
+    struct TraceEvent
+    {
+        std::string_view name;
+        std::uint32_t thread_id = 0u;
+        std::int64_t begin_ns = 0;
+        std::int64_t duration_ns = 0;
+        double value = 0.0;
+        bool counter = false;
+    };
+
+    mutable std::mutex mutex_;
+    clock_type::time_point epoch_ = clock_type::now();
+    std::vector<Stage> stages_;
+    std::vector<CounterValue> counters_;
+    std::vector<TraceEvent> trace_;
+    bool tracing_ = false;
+    std::uint64_t frame_start_allocations_ = 0u;
+    std::uint64_t frame_allocations_ = 0u;
+
+    auto stage(std::string_view name) -> Stage&;
+
+    void add_trace_event(TraceEvent const& event);
+
+    [[nodiscard]] auto since_epoch(clock_type::time_point time) const
+        -> std::int64_t;
+};
+
+/**
+ * Records the lifetime of the enclosing scope under the given name
+ */
+class ScopedTimer
+{
+public:
+    explicit ScopedTimer(std::string_view const name) noexcept
+        : name_{ name }
+    {
+    }
+
+    ScopedTimer(ScopedTimer const&) = delete;
+    auto operator=(ScopedTimer const&) -> ScopedTimer& = delete;
+
+    ~ScopedTimer()
+    {
+        Profiler::instance().record(
+            name_, begin_, Profiler::clock_type::now());
+    }
+
+private:
+    std::string_view name_;
+    Profiler::clock_type::time_point begin_ = Profiler::clock_type::now();
+};
+
+} // namespace pa093::profiling
+
+#define PA093_PROFILING_CONCAT_IMPL(a, b) a##b
+#define PA093_PROFILING_CONCAT(a, b) PA093_PROFILING_CONCAT_IMPL(a, b)
+
+#ifdef PA093_PROFILING
+
+#define PA093_PROFILE_SCOPE(name)                                              \
+    ::pa093::profiling::ScopedTimer const PA093_PROFILING_CONCAT(              \
+        pa093_profile_scope_, __LINE__)                                        \
+    {                                                                          \
+        name                                                                   \
+    }
+
+#define PA093_PROFILE_COUNTER(name, value)                                     \
+    ::pa093::profiling::Profiler::instance().set_counter(                      \
+        name, static_cast<double>(value))
+
+#define PA093_PROFILE_FRAME()                                                  \
+    ::pa093::profiling::Profiler::instance().end_frame()
+
+#else
+
+#define PA093_PROFILE_SCOPE(name) static_cast<void>(0)
+#define PA093_PROFILE_COUNTER(name, value) static_cast<void>(0)
+#define PA093_PROFILE_FRAME() static_cast<void>(0)
+
+#endif
@@ -0,0 +1,51 @@
+# Writes output, a C++ source defining pa093::render::embedded_files() with
+# the contents of the remaining arguments, paths relative to root. The files
+# become configure dependencies, so edits are embedded on the next build.
+function(embed_files output root)
+  set(entries "")
+  foreach(path IN LISTS ARGN)
+    set_property(
+      DIRECTORY
+      APPEND
+      PROPERTY CMAKE_CONFIGURE_DEPENDS "${root}/${path}"
+    )
+    file(READ "${root}/${path}" content)
+    string(
+      APPEND entries
+      "    EmbeddedFile{\n"
+      "        \"${path}\",\n"
+      "        R\"pa093_embed(${content})pa093_embed\",\n"
+      "    },\n"
+    )
+  endforeach()
+
+  file(
+    WRITE "${output}.tmp"
+    "// Generated by embed_files.cmake; do not edit\n"
+    "\n"
+    "#include <pa093/render/embedded_files.hpp>\n"
+    "\n"
+    "namespace pa093::render\n"
+    "{\n"
+    "\n"
+    "namespace\n"
+    "{\n"
+    "\n"
+    "constexpr EmbeddedFile files[] = {\n"
+    "${entries}"
+    "};\n"
+    "\n"
+    "} // namespace\n"
+    "\n"
+    "auto\n"
+    "embedded_files() noexcept -> std::span<EmbeddedFile const>\n"
+    "{\n"
+    "    return files;\n"
+    "}\n"
+    "\n"
+    "} // namespace pa093::render\n"
+  )
+
+  # Keeps the timestamp if nothing changed, to avoid needless rebuilds
+  configure_file("${output}.tmp" "${output}" COPYONLY)
+endfunction()
@@ -0,0 +1,26 @@
+#include <pa093/render/embedded_files.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+namespace pa093::render
+{
+
+auto
+embedded_file(std::string_view const path) -> std::string_view
+{
+    auto const files = embedded_files();
+    auto const match = std::ranges::find(files, path, &EmbeddedFile::path);
+
+    if (match == files.end())
+    {
+        throw std::runtime_error{ fmt::format("File {} is not embedded",
+                                              path) };
+    }
+
+    return match->content;
+}
+
+} // namespace pa093::render
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <span>
+#include <string_view>
+
+namespace pa093::render
+{
+
+struct EmbeddedFile
+{
+    /**
+     * Path relative to the repository root, e.g. "data/shader/frag.glsl"
+     */
+    std::string_view path;
+    std::string_view content;
+};
+
+/**
+ * Files under data/shader, embedded into the executable at build time. The
+ * definition is generated by embed_files.cmake.
+ */
+[[nodiscard]] auto
+embedded_files() noexcept -> std::span<EmbeddedFile const>;
+
+/**
+ * Content of the embedded file with the path; throws std::runtime_error if
+ * there is none
+ */
+[[nodiscard]] auto
+embedded_file(std::string_view path) -> std::string_view;
+
+} // namespace pa093::render
@@ -1,31 +1,92 @@
 #include <pa093/render/mesh.hpp>
 
+#include <algorithm>
+
 #include <glm/gtc/type_ptr.hpp>
 
+#include <pa093/profiling/profiler.hpp>
+
 namespace pa093::render
 {
 
-DynamicMesh2d::DynamicMesh2d(ShaderCache& shader_cache)
-    : program_{ shader_cache[program_config_path] }
-    , color_uniform_{ program_.uniform_location("color").value() }
+DynamicMesh2d::DynamicMesh2d(ShaderCache& shader_cache,
+                             VertexFormat const format)
+    : format_{ format }
+    , program_{ shader_cache[format == VertexFormat::unorm16
+                                 ? quantized_program_config_path
+                                 : program_config_path] }
+    , color_location_{ program_.uniform_location("color").value() }
 {
-    vertex_array_.bind_attribute_buffer(
-        pos_gl_buffer_.view(), program_.attribute_location("pos").value(), 2u);
+    auto const vao_bind = glpp::ScopedBind{ vertex_array_ };
+    auto const pos_location =
+        static_cast<GLuint>(program_.attribute_location("pos").value());
+
+    if (format == VertexFormat::unorm16)
+    {
+        pos_transform_location_ =
+            program_.uniform_location("pos_transform").value();
+        pos_gl_buffer_.bind_attribute(
+            pos_location, 2, GL_UNSIGNED_SHORT, GL_TRUE);
+    }
+    else
+    {
+        pos_gl_buffer_.bind_attribute(pos_location, 2);
+    }
 }
 
 void
 DynamicMesh2d::set_vertex_positions(std::span<glm::vec2 const> const points)
 {
-    pos_gl_buffer_.buffer_data(
-        { glm::value_ptr(points[0]), points.size() * 2u });
+    update_vertex_positions(points, 0u, points.size());
+}
+
+void
+DynamicMesh2d::update_vertex_positions(std::span<glm::vec2 const> const points,
+                                       std::size_t const first_changed,
+                                       std::size_t const end_changed)
+{
+    PA093_PROFILE_SCOPE("Upload vertices");
+
+    auto first = std::min(first_changed, points.size());
+    auto end = std::clamp(end_changed, first, points.size());
     num_points_ = points.size();
+
+    if (format_ == VertexFormat::float32)
+    {
+        upload(std::as_bytes(points), sizeof(glm::vec2), first, end);
+        return;
+    }
+
+    // Requantize everything over a new rectangle if a changed vertex falls
+    // outside the current one
+    auto const changed = points.subspan(first, end - first);
+    if ((first == 0u and end == points.size()) or
+        not std::ranges::all_of(changed,
+                                [&](glm::vec2 const point)
+                                { return quantization_.contains(point); }))
+    {
+        quantization_ = datastructure::Quantization::bounding(points);
+        first = 0u;
+        end = points.size();
+    }
+
+    quantized_.resize(points.size());
+    auto const count = end - first;
+    datastructure::quantize(points.subspan(first, count),
+                            quantization_,
+                            std::span{ quantized_ }.subspan(first, count));
+
+    upload(std::as_bytes(std::span{ quantized_ }),
+           sizeof(glm::u16vec2),
+           first,
+           end);
 }
 
 void
 DynamicMesh2d::draw(glpp::DrawPrimitive const primitive, glm::vec4 const color)
 {
-    auto const program_bind = glpp::ScopedBind{ program_ };
-    color_uniform_.load(color);
+    auto const program_use = ScopedUse{ program_ };
+    set_uniforms(color);
 
     auto const vao_bind = glpp::ScopedBind{ vertex_array_ };
     glpp::draw(primitive, static_cast<glpp::Size>(num_points_));
@@ -34,11 +95,47 @@ DynamicMesh2d::draw(glpp::DrawPrimitive const primitive, glm::vec4 const color)
 void
 DynamicMesh2d::draw_points(float const point_size, glm::vec4 const color)
 {
-    auto const program_bind = glpp::ScopedBind{ program_ };
-    color_uniform_.load(color);
+    auto const program_use = ScopedUse{ program_ };
+    set_uniforms(color);
 
     auto const vao_bind = glpp::ScopedBind{ vertex_array_ };
     glpp::draw_points(static_cast<glpp::Size>(num_points_), 0, point_size);
 }
 
+void
+DynamicMesh2d::upload(std::span<std::byte const> const vertices,
+                      std::size_t const vertex_size,
+                      std::size_t const first,
+                      std::size_t const end)
+{
+    if (vertices.size() > pos_gl_buffer_.capacity() or
+        (first == 0u and end * vertex_size == vertices.size()))
+    {
+        pos_gl_buffer_.assign(vertices);
+    }
+    else
+    {
+        pos_gl_buffer_.update(
+            first * vertex_size,
+            vertices.subspan(first * vertex_size, (end - first) * vertex_size));
+    }
+}
+
+void
+DynamicMesh2d::set_uniforms(glm::vec4 const color) const
+{
+    glUniform4fv(color_location_, 1, glm::value_ptr(color));
+
+    if (format_ == VertexFormat::unorm16)
+    {
+        // Normalized positions in [0, 1] to the quantization rectangle
+        auto const extent = quantization_.max - quantization_.min;
+        glUniform4f(pos_transform_location_,
+                    extent.x,
+                    extent.y,
+                    quantization_.min.x,
+                    quantization_.min.y);
+    }
+}
+
 } // namespace pa093
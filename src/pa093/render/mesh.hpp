@@ -1,15 +1,17 @@
 #pragma once
 
+#include <cstddef>
 #include <span>
+#include <vector>
 
 #include <glm/glm.hpp>
-#include <glpp/buffer.hpp>
 #include <glpp/draw.hpp>
-#include <glpp/shader_program.hpp>
-#include <glpp/uniform.hpp>
 #include <glpp/vertex_array.hpp>
 
+#include <pa093/datastructure/quantization.hpp>
 #include <pa093/render/shader_cache.hpp>
+#include <pa093/render/shader_program.hpp>
+#include <pa093/render/streaming_buffer.hpp>
 
 namespace pa093::render
 {
@@ -17,10 +19,34 @@ namespace pa093::render
 class DynamicMesh2d
 {
 public:
-    explicit DynamicMesh2d(ShaderCache& shader_cache);
+    /**
+     * How vertex positions are stored on the GPU
+     */
+    enum class VertexFormat
+    {
+        float32,
+        /**
+         * 16-bit normalized integers over the bounding rectangle of the
+         * vertices; half the size of float32, with an error far below a
+         * pixel for coordinates within the view
+         */
+        unorm16,
+    };
+
+    explicit DynamicMesh2d(ShaderCache& shader_cache,
+                           VertexFormat format = VertexFormat::float32);
 
     void set_vertex_positions(std::span<glm::vec2 const> points);
 
+    /**
+     * Replaces the vertices, given that only those in
+     * [first_changed, end_changed) differ from the previous vertices. Only
+     * that range is uploaded, unless the buffer has to grow.
+     */
+    void update_vertex_positions(std::span<glm::vec2 const> points,
+                                 std::size_t first_changed,
+                                 std::size_t end_changed);
+
     void draw(glpp::DrawPrimitive primitive, glm::vec4 color = glm::vec4(1.0f));
 
     void draw_points(float point_size = 1.0f,
@@ -28,12 +54,31 @@ public:
 
 private:
     static constexpr auto program_config_path = "data/shader/program.json";
+    static constexpr auto quantized_program_config_path =
+        "data/shader/quantized_program.json";
 
-    glpp::ShaderProgram const& program_;
-    glpp::Uniform<glm::vec4> color_uniform_;
+    VertexFormat format_;
+    ShaderProgram const& program_;
+    GLint color_location_;
+    GLint pos_transform_location_ = -1;
     glpp::VertexArray vertex_array_;
-    glpp::DynamicAttribBuffer<float> pos_gl_buffer_;
+    StreamingBuffer pos_gl_buffer_;
     std::size_t num_points_ = 0u;
+
+    // Quantized copy of the vertices, for unorm16
+    datastructure::Quantization quantization_;
+    std::vector<glm::u16vec2> quantized_;
+
+    /**
+     * Uploads the vertices in [first, end), or all of them if the buffer
+     * has to grow
+     */
+    void upload(std::span<std::byte const> vertices,
+                std::size_t vertex_size,
+                std::size_t first,
+                std::size_t end);
+
+    void set_uniforms(glm::vec4 color) const;
 };
 
 } // namespace pa093::render
@@ -0,0 +1,78 @@
+#include <pa093/render/program_binary_cache.hpp>
+
+#include <fstream>
+#include <iterator>
+#include <system_error>
+#include <vector>
+
+#include <fmt/format.h>
+#include <spdlog/spdlog.h>
+
+namespace pa093::render
+{
+
+auto
+ProgramBinaryCache::load(std::uint64_t const key,
+                         ShaderProgram const& program) const -> bool
+{
+    auto file = std::ifstream{ path(key), std::ios::binary };
+    auto format = GLenum{};
+
+    if (not file.read(reinterpret_cast<char*>(&format), sizeof(format)))
+    {
+        return false;
+    }
+
+    auto const binary = std::vector<char>{ std::istreambuf_iterator{ file },
+                                           std::istreambuf_iterator<char>{} };
+    glProgramBinary(program.id(),
+                    format,
+                    binary.data(),
+                    static_cast<GLsizei>(binary.size()));
+
+    auto linked = GLint{ GL_FALSE };
+    glGetProgramiv(program.id(), GL_LINK_STATUS, &linked);
+
+    return linked == GL_TRUE;
+}
+
+void
+ProgramBinaryCache::store(std::uint64_t const key,
+                          ShaderProgram const& program) const
+{
+    auto length = GLint{ 0 };
+    glGetProgramiv(program.id(), GL_PROGRAM_BINARY_LENGTH, &length);
+
+    if (length <= 0)
+    {
+        // The driver does not support program binaries
+        return;
+    }
+
+    auto binary = std::vector<char>(static_cast<std::size_t>(length));
+    auto format = GLenum{};
+    glGetProgramBinary(
+        program.id(), length, &length, &format, binary.data());
+
+    auto error = std::error_code{};
+    std::filesystem::create_directories(directory_, error);
+
+    auto file = std::ofstream{ path(key), std::ios::binary };
+    file.write(reinterpret_cast<char const*>(&format), sizeof(format));
+    file.write(binary.data(), length);
+
+    if (not file)
+    {
+        spdlog::warn("Failed to cache program binary in {0}",
+                     directory_.string());
+    }
+}
+
+auto
+ProgramBinaryCache::path(std::uint64_t const key) const
+    -> std::filesystem::path
+{
+    return directory_ / fmt::format("{:016x}.bin", key);
+}
+
+} // namespace pa093::render
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <utility>
+
+#include <pa093/render/shader_program.hpp>
+
+namespace pa093::render
+{
+
+/**
+ * Directory of linked program binaries, one file per key.
+ *
+ * The key must identify both the program sources and the driver, since
+ * binaries are only valid for the driver that produced them. Failures to
+ * read or write the cache are logged and otherwise ignored; the driver may
+ * also reject a binary, e.g. after an update, in which case the program
+ * has to be compiled again.
+ */
+class ProgramBinaryCache
+{
+public:
+    explicit ProgramBinaryCache(std::filesystem::path directory)
+        : directory_{ std::move(directory) }
+    {
+    }
+
+    /**
+     * Links the program from the binary cached for the key; returns false
+     * if there is none or the driver rejected it
+     */
+    [[nodiscard]] auto load(std::uint64_t key,
+                            ShaderProgram const& program) const -> bool;
+
+    /**
+     * Caches the binary of a linked program, which must have been linked
+     * with GL_PROGRAM_BINARY_RETRIEVABLE_HINT set
+     */
+    void store(std::uint64_t key, ShaderProgram const& program) const;
+
+private:
+    std::filesystem::path directory_;
+
+    [[nodiscard]] auto path(std::uint64_t key) const -> std::filesystem::path;
+};
+
+} // namespace pa093::render
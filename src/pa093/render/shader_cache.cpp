@@ -1,36 +1,227 @@
 #include <pa093/render/shader_cache.hpp>
 
-#include <fstream>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
 
-#include <glpp/config/config.hpp>
+#include <fmt/format.h>
 #include <nlohmann/json.hpp>
 
+#include <pa093/render/embedded_files.hpp>
+
 namespace pa093::render
 {
 
+namespace
+{
+
+struct ShaderSource
+{
+    GLenum type;
+    std::string source;
+};
+
+[[nodiscard]] auto
+shader_type(std::string const& name) -> GLenum
+{
+    static constexpr auto types = std::array{
+        std::pair{ "vertex_shader", GL_VERTEX_SHADER },
+        std::pair{ "tess_control_shader", GL_TESS_CONTROL_SHADER },
+        std::pair{ "tess_evaluation_shader", GL_TESS_EVALUATION_SHADER },
+        std::pair{ "geometry_shader", GL_GEOMETRY_SHADER },
+        std::pair{ "fragment_shader", GL_FRAGMENT_SHADER },
+        std::pair{ "compute_shader", GL_COMPUTE_SHADER },
+    };
+
+    for (auto const& [type_name, type] : types)
+    {
+        if (name == type_name)
+        {
+            return type;
+        }
+    }
+
+    throw std::runtime_error{ fmt::format("Unknown shader type {}", name) };
+}
+
+[[nodiscard]] auto
+read_sources(std::string_view const program_config_path)
+    -> std::vector<ShaderSource>
+{
+    auto const config =
+        nlohmann::json::parse(embedded_file(program_config_path));
+
+    auto const& version = config.at("glslVersion");
+    auto preamble = fmt::format("#version {} {}\n",
+                                version.at("versionNumber").get<int>(),
+                                version.at("profile").get<std::string>());
+    for (auto const& definition : config.at("definitions"))
+    {
+        preamble += fmt::format("#define {}\n",
+                                definition.get<std::string>());
+    }
+
+    auto sources = std::vector<ShaderSource>{};
+    for (auto const& shader : config.at("shaders"))
+    {
+        auto source = preamble;
+        for (auto const& path : shader.at("sources"))
+        {
+            source += embedded_file(path.get<std::string>());
+            source += '\n';
+        }
+
+        sources.push_back({
+            .type = shader_type(shader.at("shaderType").get<std::string>()),
+            .source = std::move(source),
+        });
+    }
+
+    return sources;
+}
+
+/**
+ * FNV-1a
+ */
+[[nodiscard]] auto
+hash(std::uint64_t value, std::string_view const data) noexcept
+    -> std::uint64_t
+{
+    for (auto const c : data)
+    {
+        value ^= static_cast<unsigned char>(c);
+        value *= 0x100000001b3u;
+    }
+
+    return value;
+}
+
+/**
+ * Identifies the sources together with the driver, which binaries are
+ * specific to
+ */
+[[nodiscard]] auto
+binary_key(std::vector<ShaderSource> const& sources) -> std::uint64_t
+{
+    auto key = std::uint64_t{ 0xcbf29ce484222325u };
+
+    for (auto const name : { GL_VENDOR, GL_RENDERER, GL_VERSION })
+    {
+        key = hash(key,
+                   reinterpret_cast<char const*>(glGetString(name)));
+    }
+    for (auto const& [type, source] : sources)
+    {
+        key = hash(key, fmt::format("{}\n", type));
+        key = hash(key, source);
+    }
+
+    return key;
+}
+
+void
+compile_and_link(ShaderProgram const& program,
+                 std::vector<ShaderSource> const& sources,
+                 bool const retrievable)
+{
+    auto shaders = std::vector<GLuint>{};
+    auto const delete_shaders = [&]
+    {
+        for (auto const shader : shaders)
+        {
+            glDetachShader(program.id(), shader);
+            glDeleteShader(shader);
+        }
+    };
+    auto info_log = std::string{};
+
+    for (auto const& [type, source] : sources)
+    {
+        auto const shader = shaders.emplace_back(glCreateShader(type));
+        glAttachShader(program.id(), shader);
+
+        auto const* const data = source.c_str();
+        glShaderSource(shader, 1, &data, nullptr);
+        glCompileShader(shader);
+
+        auto compiled = GLint{ GL_FALSE };
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+        if (compiled != GL_TRUE)
+        {
+            auto length = GLint{ 0 };
+            glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &length);
+            info_log.resize(static_cast<std::size_t>(std::max(length, 1)));
+            glGetShaderInfoLog(shader, length, nullptr, info_log.data());
+
+            delete_shaders();
+            throw std::runtime_error{ fmt::format(
+                "Failed to compile shader: {}", info_log.c_str()) };
+        }
+    }
+
+    if (retrievable)
+    {
+        glProgramParameteri(
+            program.id(), GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+    glLinkProgram(program.id());
+    delete_shaders();
+
+    auto linked = GLint{ GL_FALSE };
+    glGetProgramiv(program.id(), GL_LINK_STATUS, &linked);
+    if (linked != GL_TRUE)
+    {
+        auto length = GLint{ 0 };
+        glGetProgramiv(program.id(), GL_INFO_LOG_LENGTH, &length);
+        info_log.resize(static_cast<std::size_t>(std::max(length, 1)));
+        glGetProgramInfoLog(program.id(), length, nullptr, info_log.data());
+
+        throw std::runtime_error{ fmt::format("Failed to link program: {}",
+                                              info_log.c_str()) };
+    }
+}
+
+} // namespace
+
 auto
-load_shader_from_config(std::filesystem::path const& shader_config_path)
-    -> glpp::ShaderProgram
+make_program(std::string_view const program_config_path,
+             ProgramBinaryCache const* const binary_cache) -> ShaderProgram
 {
-    auto shader_config_file = std::ifstream{ shader_config_path };
-    auto shader_config = nlohmann::json();
-    shader_config_file >> shader_config;
-    return glpp::config::make_shader_program(shader_config);
+    auto const sources = read_sources(program_config_path);
+    auto program = ShaderProgram{};
+
+    if (binary_cache == nullptr)
+    {
+        compile_and_link(program, sources, false);
+        return program;
+    }
+
+    auto const key = binary_key(sources);
+    if (not binary_cache->load(key, program))
+    {
+        compile_and_link(program, sources, true);
+        binary_cache->store(key, program);
+    }
+
+    return program;
 }
 
 auto
-ShaderCache::operator[](std::filesystem::path const& shader_config_path)
-    -> glpp::ShaderProgram const&
+ShaderCache::operator[](std::string_view const program_config_path)
+    -> ShaderProgram const&
 {
-    auto canonical_path =
-        std::filesystem::canonical(shader_config_path).string();
-    auto match = programs_.find(canonical_path);
+    auto match = programs_.find(std::string{ program_config_path });
 
     if (match == programs_.end())
     {
-        std::tie(match, std::ignore) =
-            programs_.emplace(std::move(canonical_path),
-                              load_shader_from_config(shader_config_path));
+        std::tie(match, std::ignore) = programs_.emplace(
+            program_config_path,
+            make_program(program_config_path,
+                         binary_cache_ ? &*binary_cache_ : nullptr));
     }
 
     return match->second;
@@ -1,26 +1,54 @@
 #pragma once
 
 #include <filesystem>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
-#include <glpp/shader_program.hpp>
+#include <pa093/render/program_binary_cache.hpp>
+#include <pa093/render/shader_program.hpp>
 
 namespace pa093::render
 {
 
-[[nodiscard]] auto load_shader_from_config(
-    std::filesystem::path const& shader_config_path) -> glpp::ShaderProgram;
+/**
+ * Builds a program from an embedded program config, in the format of
+ * data/shader/program.json, with the GLSL sources it lists also taken from
+ * the embedded files. The sources are prefixed with the GLSL version and
+ * the definitions of the config.
+ *
+ * If a binary cache is given, the program is loaded from it when possible,
+ * and otherwise compiled and stored in it.
+ */
+[[nodiscard]] auto
+make_program(std::string_view program_config_path,
+             ProgramBinaryCache const* binary_cache = nullptr)
+    -> ShaderProgram;
 
+/**
+ * Programs by embedded config path, each built once
+ */
 class ShaderCache
 {
 public:
-    [[nodiscard]] auto operator[](
-        std::filesystem::path const& shader_config_path)
-        -> glpp::ShaderProgram const&;
+    ShaderCache() = default;
+
+    /**
+     * Additionally caches program binaries in the directory, so that later
+     * runs skip compilation
+     */
+    explicit ShaderCache(std::filesystem::path binary_cache_directory)
+        : binary_cache_{ std::in_place, std::move(binary_cache_directory) }
+    {
+    }
+
+    [[nodiscard]] auto operator[](std::string_view program_config_path)
+        -> ShaderProgram const&;
 
 private:
-    std::unordered_map<std::string, glpp::ShaderProgram> programs_;
+    std::optional<ProgramBinaryCache> binary_cache_;
+    std::unordered_map<std::string, ShaderProgram> programs_;
 };
 
 } // namespace pa093::render
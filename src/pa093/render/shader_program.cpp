@@ -0,0 +1,58 @@
+#include <pa093/render/shader_program.hpp>
+
+#include <utility>
+
+namespace pa093::render
+{
+
+namespace
+{
+
+[[nodiscard]] auto
+valid_location(GLint const location) noexcept -> std::optional<GLint>
+{
+    return location >= 0 ? std::optional{ location } : std::nullopt;
+}
+
+} // namespace
+
+ShaderProgram::ShaderProgram()
+    : id_{ glCreateProgram() }
+{
+}
+
+ShaderProgram::~ShaderProgram()
+{
+    if (id_ != 0u)
+    {
+        glDeleteProgram(id_);
+    }
+}
+
+ShaderProgram::ShaderProgram(ShaderProgram&& other) noexcept
+    : id_{ std::exchange(other.id_, 0u) }
+{
+}
+
+auto
+ShaderProgram::operator=(ShaderProgram&& other) noexcept -> ShaderProgram&
+{
+    std::swap(id_, other.id_);
+    return *this;
+}
+
+auto
+ShaderProgram::uniform_location(char const* const name) const
+    -> std::optional<GLint>
+{
+    return valid_location(glGetUniformLocation(id_, name));
+}
+
+auto
+ShaderProgram::attribute_location(char const* const name) const
+    -> std::optional<GLint>
+{
+    return valid_location(glGetAttribLocation(id_, name));
+}
+
+} // namespace pa093::render
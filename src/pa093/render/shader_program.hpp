@@ -0,0 +1,53 @@
+#pragma once
+
+#include <optional>
+
+#include <glpp/shader_program.hpp>
+
+namespace pa093::render
+{
+
+/**
+ * Owns an OpenGL program object. Built by ShaderCache, either by compiling
+ * embedded sources or from a cached program binary.
+ */
+class ShaderProgram
+{
+public:
+    ShaderProgram();
+
+    ~ShaderProgram();
+
+    ShaderProgram(ShaderProgram&& other) noexcept;
+    auto operator=(ShaderProgram&& other) noexcept -> ShaderProgram&;
+
+    [[nodiscard]] auto id() const noexcept -> GLuint { return id_; }
+
+    [[nodiscard]] auto uniform_location(char const* name) const
+        -> std::optional<GLint>;
+
+    [[nodiscard]] auto attribute_location(char const* name) const
+        -> std::optional<GLint>;
+
+private:
+    GLuint id_ = 0u;
+};
+
+/**
+ * Makes a program current for the lifetime of the object
+ */
+class ScopedUse
+{
+public:
+    [[nodiscard]] explicit ScopedUse(ShaderProgram const& program) noexcept
+    {
+        glUseProgram(program.id());
+    }
+
+    ~ScopedUse() { glUseProgram(0u); }
+
+    ScopedUse(ScopedUse const&) = delete;
+    auto operator=(ScopedUse const&) -> ScopedUse& = delete;
+};
+
+} // namespace pa093::render
@@ -0,0 +1,90 @@
+#include <pa093/render/streaming_buffer.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace pa093::render
+{
+
+StreamingBuffer::StreamingBuffer()
+{
+    glGenBuffers(1, &id_);
+}
+
+StreamingBuffer::~StreamingBuffer()
+{
+    glDeleteBuffers(1, &id_);
+}
+
+void
+StreamingBuffer::assign(std::span<std::byte const> const data)
+{
+    // Uploads go through the copy target, so that they neither disturb the
+    // array buffer binding nor the element buffer of the bound vertex array
+    glBindBuffer(GL_COPY_WRITE_BUFFER, id_);
+
+    if (data.size() > capacity_)
+    {
+        capacity_ = std::max(data.size(), capacity_ + capacity_ / 2u);
+    }
+
+    // Orphan the storage; draws still reading it keep the old copy
+    glBufferData(GL_COPY_WRITE_BUFFER,
+                 static_cast<GLsizeiptr>(capacity_),
+                 nullptr,
+                 GL_STREAM_DRAW);
+    if (not data.empty())
+    {
+        glBufferSubData(GL_COPY_WRITE_BUFFER,
+                        0,
+                        static_cast<GLsizeiptr>(data.size()),
+                        data.data());
+    }
+    size_ = data.size();
+
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0u);
+}
+
+void
+StreamingBuffer::update(std::size_t const offset,
+                        std::span<std::byte const> const data)
+{
+    if (offset + data.size() > capacity_)
+    {
+        throw std::out_of_range{ "Buffer update exceeds capacity" };
+    }
+
+    if (data.empty())
+    {
+        return;
+    }
+
+    glBindBuffer(GL_COPY_WRITE_BUFFER, id_);
+    glBufferSubData(GL_COPY_WRITE_BUFFER,
+                    static_cast<GLintptr>(offset),
+                    static_cast<GLsizeiptr>(data.size()),
+                    data.data());
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0u);
+
+    size_ = std::max(size_, offset + data.size());
+}
+
+void
+StreamingBuffer::bind_attribute(GLuint const location,
+                                GLint const components,
+                                GLenum const type,
+                                GLboolean const normalized) const
+{
+    glBindBuffer(GL_ARRAY_BUFFER, id_);
+    glEnableVertexAttribArray(location);
+    glVertexAttribPointer(location, components, type, normalized, 0, nullptr);
+    glBindBuffer(GL_ARRAY_BUFFER, 0u);
+}
+
+void
+StreamingBuffer::bind_elements() const
+{
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id_);
+}
+
+} // namespace pa093::render
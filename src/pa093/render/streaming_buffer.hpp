@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+#include <glpp/buffer.hpp>
+
+namespace pa093::render
+{
+
+/**
+ * Vertex or index buffer for data that is replaced or patched every few
+ * frames.
+ *
+ * Storage grows geometrically and is only reallocated when the data
+ * outgrows it. Replacing all data orphans the storage first, so the upload
+ * does not wait for draws still reading the previous data; updating a range
+ * uploads only that range.
+ */
+class StreamingBuffer
+{
+public:
+    StreamingBuffer();
+
+    ~StreamingBuffer();
+
+    StreamingBuffer(StreamingBuffer const&) = delete;
+    auto operator=(StreamingBuffer const&) -> StreamingBuffer& = delete;
+
+    /**
+     * Replaces the whole content
+     */
+    void assign(std::span<std::byte const> data);
+
+    /**
+     * Overwrites the content at the byte offset, extending the size if
+     * needed. The end of the range must be within capacity().
+     */
+    void update(std::size_t offset, std::span<std::byte const> data);
+
+    /**
+     * Sources a vertex attribute of the currently bound vertex array from
+     * this buffer, with the given number of tightly packed components of the
+     * given type. Normalized integer components read as [0, 1] in shaders.
+     */
+    void bind_attribute(GLuint location,
+                        GLint components,
+                        GLenum type = GL_FLOAT,
+                        GLboolean normalized = GL_FALSE) const;
+
+    /**
+     * Sources the indices of the currently bound vertex array from this
+     * buffer
+     */
+    void bind_elements() const;
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return size_; }
+
+    [[nodiscard]] auto capacity() const noexcept -> std::size_t
+    {
+        return capacity_;
+    }
+
+private:
+    GLuint id_ = 0u;
+    std::size_t size_ = 0u;
+    std::size_t capacity_ = 0u;
+};
+
+} // namespace pa093::render
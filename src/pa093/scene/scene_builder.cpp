@@ -0,0 +1,746 @@
+#include <pa093/scene/scene_builder.hpp>
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <ranges>
+#include <utility>
+
+#include <gsl/gsl_assert>
+#include <spdlog/spdlog.h>
+
+#include <pa093/profiling/allocation_counter.hpp>
+#include <pa093/profiling/profiler.hpp>
+
+namespace pa093::scene
+{
+
+namespace
+{
+
+[[nodiscard]] auto
+lexicographic(glm::vec2 const p) noexcept -> std::pair<float, float>
+{
+    return { p.x, p.y };
+}
+
+} // namespace
+
+auto
+SceneBuilder::operator()(SceneInput const& input,
+                         SceneGeometry& geometry,
+                         std::function<bool()> const& cancelled) -> bool
+{
+    PA093_PROFILE_SCOPE("Build scene");
+
+    [[maybe_unused]] auto const allocations = profiling::allocation_count();
+    [[maybe_unused]] auto const pool_allocations = heap_.allocations();
+
+    geometry.generation = input.generation;
+    geometry.settings = input.settings;
+
+    // The geometry of the points before the relaxation is still completed,
+    // from the cached stages unless the points changed as well
+    if (not show_relaxed_points(input, geometry, cancelled))
+    {
+        return false;
+    }
+
+    auto const& settings = input.settings;
+    auto const needs_point_order =
+        settings.polygon_mode != PolygonMode::none or
+        settings.triangulation_mode == TriangulationMode::sweep_line or
+        settings.triangulation_mode == TriangulationMode::delaunay or
+        settings.triangulation_mode == TriangulationMode::delaunay_plus_voronoi;
+    auto const needs_polygon =
+        settings.polygon_mode != PolygonMode::none or
+        settings.triangulation_mode == TriangulationMode::sweep_line;
+    auto const needs_triangulation =
+        settings.graph_mode != GraphMode::none or
+        settings.triangulation_mode ==
+            TriangulationMode::delaunay_plus_voronoi_cells or
+        settings.triangulation_mode == TriangulationMode::alpha_shape;
+
+    // Stages read by several branches first, so that the branches only read
+    // them and can run concurrently
+    concurrency::parallel_invoke(
+        *jobs_,
+        [&]
+        {
+            if (needs_point_order)
+            {
+                update_point_order(input);
+            }
+        },
+        [&]
+        {
+            if (needs_polygon)
+            {
+                update_polygon(input);
+            }
+        },
+        [&]
+        {
+            if (needs_triangulation)
+            {
+                update_triangulation(input);
+            }
+        });
+    if (cancelled())
+    {
+        return false;
+    }
+
+    geometry.points.assign(input.points_version, input.points);
+
+    // Each branch stops at its next stage boundary once cancelled
+    auto completed = std::array<bool, 4u>{};
+    concurrency::parallel_invoke(
+        *jobs_,
+        [&] { completed[0] = show_polygon(input, geometry, cancelled); },
+        [&] { completed[1] = show_triangulation(input, geometry, cancelled); },
+        [&] { completed[2] = show_graph(input, geometry, cancelled); },
+        [&] { completed[3] = show_partitioning(input, geometry, cancelled); });
+
+    PA093_PROFILE_COUNTER("Scene heap allocations",
+                          profiling::allocation_count() - allocations);
+    PA093_PROFILE_COUNTER("Scene pool upstream allocations",
+                          heap_.allocations() - pool_allocations);
+
+    return std::ranges::all_of(completed, std::identity{}) and not cancelled();
+}
+
+void
+SceneBuilder::reset()
+{
+    point_order_.reset();
+    polygon_.reset();
+    polygon_indices_.reset();
+    sweep_line_triangles_.reset();
+    delaunay_triangles_.reset();
+    delaunay_triangle_indices_.reset();
+    dual_graph_edges_.reset();
+    triangulation_.reset();
+    voronoi_cell_edges_.reset();
+    alpha_shape_.reset();
+    alpha_shape_query_.reset();
+    graph_.reset();
+    kd_tree_.reset();
+    sweep_line_points_.clear();
+    voronoi_points_.clear();
+    voronoi_order_.clear();
+    voronoi_cell_polygons_.clear();
+    alpha_shape_edges_.clear();
+    graph_edges_.clear();
+    alpha_shape_triangles_.clear();
+    relaxed_points_.clear();
+}
+
+auto
+SceneBuilder::show_relaxed_points(SceneInput const& input,
+                                  SceneGeometry& geometry,
+                                  std::function<bool()> const& cancelled)
+    -> bool
+{
+    if (input.relaxation == 0u)
+    {
+        return true;
+    }
+
+    if (relaxed_points_.relaxation != input.relaxation or
+        relaxed_points_.points_version != input.points_version)
+    {
+        PA093_PROFILE_SCOPE("Lloyd relaxation");
+
+        relaxed_points_.clear();
+        lloyd_relaxation_(input.points, relaxation_triangulation_, cancelled);
+        if (cancelled())
+        {
+            return false;
+        }
+
+        auto const points = std::as_const(relaxation_triangulation_).points();
+        relaxed_points_.points.assign(points.begin(), points.end());
+        relaxed_points_.relaxation = input.relaxation;
+        relaxed_points_.points_version = input.points_version;
+    }
+
+    if (geometry.relaxed_points.relaxation != relaxed_points_.relaxation or
+        geometry.relaxed_points.points_version !=
+            relaxed_points_.points_version)
+    {
+        geometry.relaxed_points = relaxed_points_;
+    }
+
+    return true;
+}
+
+auto
+SceneBuilder::update_point_order(SceneInput const& input)
+    -> IndexListStage const&
+{
+    point_order_.update(input.points_version,
+                        [&](index_list& order)
+                        {
+                            PA093_PROFILE_SCOPE("Point order");
+
+                            order.resize(input.points.size());
+                            std::iota(order.begin(), order.end(), 0u);
+                            std::ranges::sort(
+                                order,
+                                std::less{},
+                                [&](index_type const i)
+                                { return lexicographic(input.points[i]); });
+                        });
+
+    return point_order_;
+}
+
+auto
+SceneBuilder::update_polygon(SceneInput const& input) -> PolygonStage const&
+{
+    auto const mode = input.settings.polygon_mode;
+
+    polygon_.update({ input.points_version, mode },
+                    [&](point_list& polygon_points)
+                    {
+                        PA093_PROFILE_SCOPE("Polygon");
+
+                        polygon_points.clear();
+
+                        switch (mode)
+                        {
+                            case PolygonMode::none:
+                                break;
+                            case PolygonMode::all_points:
+                                polygon_points = input.points;
+                                break;
+                            case PolygonMode::gift_wrapping_convex_hull:
+                                gift_wrapping_(
+                                    input.points,
+                                    std::back_inserter(polygon_points));
+                                break;
+                            case PolygonMode::graham_scan_convex_hull:
+                                graham_scan_(
+                                    input.points,
+                                    std::back_inserter(polygon_points));
+                                break;
+                        }
+                    });
+
+    return polygon_;
+}
+
+auto
+SceneBuilder::update_polygon_indices(SceneInput const& input)
+    -> IndexListStage const&
+{
+    auto const& polygon = update_polygon(input);
+
+    polygon_indices_.update(polygon.version(),
+                            [&](index_list& indices)
+                            {
+                                indices.clear();
+                                find_indices(input, polygon.output(), indices);
+                            });
+
+    return polygon_indices_;
+}
+
+auto
+SceneBuilder::update_sweep_line_triangles(SceneInput const& input)
+    -> IndexListStage const&
+{
+    auto const& polygon = update_polygon(input);
+
+    sweep_line_triangles_.update(
+        polygon.version(),
+        [&](index_list& indices)
+        {
+            PA093_PROFILE_SCOPE("Sweep line");
+
+            sweep_line_points_.clear();
+            sweep_line_(polygon.output(),
+                        std::back_inserter(sweep_line_points_));
+
+            indices.clear();
+            find_indices(input, sweep_line_points_, indices);
+        });
+
+    return sweep_line_triangles_;
+}
+
+auto
+SceneBuilder::update_delaunay_triangles(SceneInput const& input)
+    -> PointListStage const&
+{
+    delaunay_triangles_.update(
+        input.points_version,
+        [&](point_list& triangle_points)
+        {
+            PA093_PROFILE_SCOPE("Delaunay");
+
+            triangle_points.clear();
+            delaunay_(input.points, std::back_inserter(triangle_points));
+        });
+
+    return delaunay_triangles_;
+}
+
+auto
+SceneBuilder::update_delaunay_triangle_indices(SceneInput const& input)
+    -> IndexListStage const&
+{
+    auto const& triangles = update_delaunay_triangles(input);
+
+    delaunay_triangle_indices_.update(
+        triangles.version(),
+        [&](index_list& indices)
+        {
+            indices.clear();
+            find_indices(input, triangles.output(), indices);
+        });
+
+    return delaunay_triangle_indices_;
+}
+
+auto
+SceneBuilder::update_dual_graph_edges(SceneInput const& input)
+    -> IndexedLinesStage const&
+{
+    auto const& triangles = update_delaunay_triangles(input);
+
+    dual_graph_edges_.update(
+        triangles.version(),
+        [&](IndexedLines& lines)
+        {
+            PA093_PROFILE_SCOPE("Dual graph");
+
+            voronoi_points_.clear();
+            voronoi_(triangles.output(), std::back_inserter(voronoi_points_));
+            weld_lines(voronoi_points_, lines);
+        });
+
+    return dual_graph_edges_;
+}
+
+auto
+SceneBuilder::update_triangulation(SceneInput const& input)
+    -> TriangulationStage const&
+{
+    triangulation_.update(input.points_version,
+                          [&](datastructure::Triangulation& triangulation)
+                          {
+                              PA093_PROFILE_SCOPE("Indexed Delaunay");
+                              if (not indexed_delaunay_(input.points,
+                                                        triangulation))
+                              {
+                                  spdlog::warn("Rounding left some points "
+                                               "out of the triangulation");
+                              }
+                          });
+
+    return triangulation_;
+}
+
+auto
+SceneBuilder::update_voronoi_cell_edges(SceneInput const& input)
+    -> IndexedLinesStage const&
+{
+    auto const& triangulation = update_triangulation(input);
+
+    voronoi_cell_edges_.update(
+        triangulation.version(),
+        [&](IndexedLines& lines)
+        {
+            PA093_PROFILE_SCOPE("Voronoi cells");
+
+            voronoi_cells_(triangulation.output(), voronoi_cell_polygons_);
+
+            voronoi_points_.clear();
+            for (auto const i : std::views::iota(
+                     std::size_t{ 0 }, voronoi_cell_polygons_.size()))
+            {
+                // Output cell boundary as line segments
+                auto const cell = voronoi_cell_polygons_.polygon(i);
+                for (auto const j :
+                     std::views::iota(std::size_t{ 0 }, cell.size()))
+                {
+                    voronoi_points_.push_back(cell[j]);
+                    voronoi_points_.push_back(cell[(j + 1u) % cell.size()]);
+                }
+            }
+
+            weld_lines(voronoi_points_, lines);
+        });
+
+    return voronoi_cell_edges_;
+}
+
+auto
+SceneBuilder::update_alpha_shape(SceneInput const& input)
+    -> AlphaShapeStage const&
+{
+    auto const& triangulation = update_triangulation(input);
+
+    alpha_shape_.update(
+        triangulation.version(),
+        [&](algorithm::triangulation::AlphaShape& alpha_shape)
+        {
+            PA093_PROFILE_SCOPE("Alpha shape");
+            alpha_shape(triangulation.output());
+        });
+
+    return alpha_shape_;
+}
+
+auto
+SceneBuilder::update_alpha_shape_query(SceneInput const& input)
+    -> AlphaShapeQueryStage const&
+{
+    auto const& triangulation = update_triangulation(input).output();
+    auto const& alpha_shape = update_alpha_shape(input);
+    auto const alpha = input.settings.alpha;
+
+    alpha_shape_query_.update(
+        { alpha_shape.version(), alpha },
+        [&](AlphaShapeQuery& query)
+        {
+            PA093_PROFILE_SCOPE("Alpha shape query");
+
+            query.triangle_indices.clear();
+            query.boundary_indices.clear();
+
+            alpha_shape_triangles_.clear();
+            alpha_shape.output().triangles(
+                alpha, std::back_inserter(alpha_shape_triangles_));
+            for (auto const t : alpha_shape_triangles_)
+            {
+                std::ranges::copy(triangulation.triangle(t),
+                                  std::back_inserter(query.triangle_indices));
+            }
+
+            alpha_shape_edges_.clear();
+            alpha_shape.output().boundary(
+                alpha, std::back_inserter(alpha_shape_edges_));
+            for (auto const [a, b] : alpha_shape_edges_)
+            {
+                query.boundary_indices.push_back(a);
+                query.boundary_indices.push_back(b);
+            }
+        });
+
+    return alpha_shape_query_;
+}
+
+auto
+SceneBuilder::update_graph(SceneInput const& input) -> GraphStage const&
+{
+    auto const& triangulation = update_triangulation(input);
+    auto const mode = input.settings.graph_mode;
+
+    graph_.update(
+        { triangulation.version(), mode },
+        [&](Graph& graph)
+        {
+            PA093_PROFILE_SCOPE("Graph");
+
+            auto const& t = triangulation.output();
+
+            graph_edges_.clear();
+            graph.length = 0.0f;
+
+            switch (mode)
+            {
+                case GraphMode::none:
+                    break;
+                case GraphMode::euclidean_mst:
+                    euclidean_mst_(t, std::back_inserter(graph_edges_));
+                    graph.length =
+                        static_cast<float>(euclidean_mst_.total_length());
+                    break;
+                case GraphMode::closest_pair:
+                    if (auto const pair = closest_pair_(t))
+                    {
+                        graph_edges_.push_back(*pair);
+                        graph.length = glm::distance(t.point((*pair)[0]),
+                                                     t.point((*pair)[1]));
+                    }
+                    break;
+            }
+
+            graph.indices.clear();
+            for (auto const [a, b] : graph_edges_)
+            {
+                graph.indices.push_back(a);
+                graph.indices.push_back(b);
+            }
+        });
+
+    return graph_;
+}
+
+auto
+SceneBuilder::update_kd_tree(SceneInput const& input) -> KDTreeStage const&
+{
+    kd_tree_.update(input.points_version,
+                    [&](datastructure::KDTree2f& kd_tree)
+                    {
+                        PA093_PROFILE_SCOPE("k-D tree");
+                        build_kd_tree_(input.points, kd_tree);
+                    });
+
+    return kd_tree_;
+}
+
+void
+SceneBuilder::find_indices(SceneInput const& input,
+                           std::span<glm::vec2 const> const points,
+                           index_list& indices) const
+{
+    auto const& order = point_order_.output();
+
+    for (auto const point : points)
+    {
+        auto const it = std::ranges::lower_bound(
+            order,
+            lexicographic(point),
+            std::less{},
+            [&](index_type const i) { return lexicographic(input.points[i]); });
+        Expects(it != order.end() and input.points[*it] == point);
+
+        indices.push_back(*it);
+    }
+}
+
+void
+SceneBuilder::weld_lines(std::span<glm::vec2 const> const points,
+                         IndexedLines& lines)
+{
+    voronoi_order_.resize(points.size());
+    std::iota(voronoi_order_.begin(), voronoi_order_.end(), 0u);
+    std::ranges::sort(voronoi_order_,
+                      std::less{},
+                      [&](index_type const i)
+                      { return lexicographic(points[i]); });
+
+    lines.vertices.clear();
+    lines.indices.resize(points.size());
+    for (auto const i : voronoi_order_)
+    {
+        if (lines.vertices.empty() or lines.vertices.back() != points[i])
+        {
+            lines.vertices.push_back(points[i]);
+        }
+        lines.indices[i] = static_cast<index_type>(lines.vertices.size() - 1u);
+    }
+}
+
+auto
+SceneBuilder::show_polygon(SceneInput const& input,
+                           SceneGeometry& geometry,
+                           std::function<bool()> const& cancelled) -> bool
+{
+    if (input.settings.polygon_mode == PolygonMode::none)
+    {
+        geometry.polygon.clear();
+        return true;
+    }
+
+    auto const& indices = update_polygon_indices(input);
+    if (cancelled())
+    {
+        return false;
+    }
+
+    geometry.polygon.assign(indices.version(), indices.output());
+    return true;
+}
+
+auto
+SceneBuilder::show_triangulation(SceneInput const& input,
+                                 SceneGeometry& geometry,
+                                 std::function<bool()> const& cancelled)
+    -> bool
+{
+    auto const show_triangles = [&](IndexListStage const& triangles)
+    { geometry.triangles.assign(triangles.version(), triangles.output()); };
+    auto const show_voronoi = [&](IndexedLinesStage const& voronoi)
+    {
+        geometry.voronoi_vertices.assign(voronoi.version(),
+                                         voronoi.output().vertices);
+        geometry.voronoi.assign(voronoi.version(), voronoi.output().indices);
+    };
+    auto const clear_voronoi = [&]
+    {
+        geometry.voronoi_vertices.clear();
+        geometry.voronoi.clear();
+    };
+
+    geometry.num_alpha_shape_triangles = 0u;
+    geometry.num_alpha_shape_boundary_edges = 0u;
+
+    // Stages are brought up to date one at a time; the later updates find
+    // the earlier stages current
+    switch (input.settings.triangulation_mode)
+    {
+        case TriangulationMode::none:
+            geometry.triangles.clear();
+            clear_voronoi();
+            geometry.alpha_shape_boundary.clear();
+            break;
+        case TriangulationMode::sweep_line:
+        {
+            auto const& triangles = update_sweep_line_triangles(input);
+            if (cancelled())
+            {
+                return false;
+            }
+
+            show_triangles(triangles);
+            clear_voronoi();
+            geometry.alpha_shape_boundary.clear();
+            break;
+        }
+        case TriangulationMode::delaunay:
+        case TriangulationMode::delaunay_plus_voronoi:
+        {
+            update_delaunay_triangles(input);
+            if (cancelled())
+            {
+                return false;
+            }
+
+            auto const& triangles = update_delaunay_triangle_indices(input);
+            if (cancelled())
+            {
+                return false;
+            }
+
+            show_triangles(triangles);
+            geometry.alpha_shape_boundary.clear();
+
+            if (input.settings.triangulation_mode ==
+                TriangulationMode::delaunay)
+            {
+                clear_voronoi();
+                break;
+            }
+
+            auto const& voronoi = update_dual_graph_edges(input);
+            if (cancelled())
+            {
+                return false;
+            }
+
+            show_voronoi(voronoi);
+            break;
+        }
+        case TriangulationMode::delaunay_plus_voronoi_cells:
+        {
+            auto const& triangulation = update_triangulation(input);
+            geometry.triangles.assign(triangulation.version(),
+                                      triangulation.output().triangles());
+            geometry.alpha_shape_boundary.clear();
+
+            auto const& voronoi = update_voronoi_cell_edges(input);
+            if (cancelled())
+            {
+                return false;
+            }
+
+            show_voronoi(voronoi);
+            break;
+        }
+        case TriangulationMode::alpha_shape:
+        {
+            update_alpha_shape(input);
+            if (cancelled())
+            {
+                return false;
+            }
+
+            auto const& query = update_alpha_shape_query(input);
+            if (cancelled())
+            {
+                return false;
+            }
+
+            auto const& output = query.output();
+
+            geometry.triangles.assign(query.version(),
+                                      output.triangle_indices);
+            clear_voronoi();
+            geometry.alpha_shape_boundary.assign(query.version(),
+                                                 output.boundary_indices);
+            geometry.num_alpha_shape_triangles =
+                output.triangle_indices.size() / 3u;
+            geometry.num_alpha_shape_boundary_edges =
+                output.boundary_indices.size() / 2u;
+            break;
+        }
+    }
+
+    return true;
+}
+
+auto
+SceneBuilder::show_graph(SceneInput const& input,
+                         SceneGeometry& geometry,
+                         std::function<bool()> const& cancelled) -> bool
+{
+    if (input.settings.graph_mode == GraphMode::none)
+    {
+        geometry.graph.clear();
+        geometry.num_graph_edges = 0u;
+        geometry.graph_length = 0.0f;
+        return true;
+    }
+
+    auto const& graph = update_graph(input);
+    if (cancelled())
+    {
+        return false;
+    }
+
+    geometry.graph.assign(graph.version(), graph.output().indices);
+    geometry.num_graph_edges = graph.output().indices.size() / 2u;
+    geometry.graph_length = graph.output().length;
+    return true;
+}
+
+auto
+SceneBuilder::show_partitioning(SceneInput const& input,
+                                SceneGeometry& geometry,
+                                std::function<bool()> const& cancelled)
+    -> bool
+{
+    switch (input.settings.partitioning_mode)
+    {
+        case PartitioningMode::none:
+            geometry.kd_tree.clear();
+            geometry.kd_tree_version = 0u;
+            break;
+        case PartitioningMode::kd_tree:
+        {
+            auto const& kd_tree = update_kd_tree(input);
+            if (cancelled())
+            {
+                return false;
+            }
+
+            if (geometry.kd_tree_version != kd_tree.version())
+            {
+                geometry.kd_tree = kd_tree.output();
+                geometry.kd_tree_version = kd_tree.version();
+            }
+            break;
+        }
+    }
+
+    return true;
+}
+
+} // namespace pa093::scene
@@ -0,0 +1,270 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory_resource>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <pa093/algorithm/convex_hull/gift_wrapping.hpp>
+#include <pa093/algorithm/convex_hull/graham_scan.hpp>
+#include <pa093/algorithm/graph/closest_pair.hpp>
+#include <pa093/algorithm/graph/euclidean_mst.hpp>
+#include <pa093/algorithm/kd_tree/build_kd_tree.hpp>
+#include <pa093/algorithm/triangulation/alpha_shape.hpp>
+#include <pa093/algorithm/triangulation/delaunay.hpp>
+#include <pa093/algorithm/triangulation/dual_graph.hpp>
+#include <pa093/algorithm/triangulation/indexed_delaunay.hpp>
+#include <pa093/algorithm/triangulation/lloyd_relaxation.hpp>
+#include <pa093/algorithm/triangulation/sweep_line.hpp>
+#include <pa093/algorithm/triangulation/voronoi_cells.hpp>
+#include <pa093/concurrency/job_system.hpp>
+#include <pa093/datastructure/kd_tree.hpp>
+#include <pa093/datastructure/polygon_set.hpp>
+#include <pa093/datastructure/triangulation.hpp>
+#include <pa093/memory/counting_resource.hpp>
+#include <pa093/scene/scene_geometry.hpp>
+#include <pa093/scene/scene_input.hpp>
+#include <pa093/scene/stage.hpp>
+
+namespace pa093::scene
+{
+
+/**
+ * Runs the algorithms enabled in the scene settings as a pipeline of cached
+ * stages:
+ *
+ *   points -> polygon -> sweep line triangulation
+ *   points -> Delaunay -> dual graph
+ *   points -> indexed triangulation -> Voronoi cells
+ *                                   -> alpha shape -> alpha shape query
+ *                                   -> graph
+ *   points -> k-D tree
+ *
+ * A Lloyd relaxation of the points requested by the input runs before the
+ * pipeline; its result is handed back with the geometry, to replace the
+ * points of the next input.
+ *
+ * Each stage is keyed by the versions of its inputs and the settings it
+ * depends on, so only stages invalidated by a change of the points or
+ * settings are rerun. Independent branches of the pipeline run concurrently
+ * on the job system.
+ *
+ * Layers are output as indices into the input points, found through the
+ * points sorted by position, so that renderers upload the points once and
+ * only indices per layer. Voronoi edges, whose vertices are not input
+ * points, are welded into indexed lines with their own vertices.
+ *
+ * The scratch memory of the algorithms comes from a pool owned by the
+ * builder; stage outputs and geometry layers reuse the capacity of their
+ * vectors. Once all of them, including every geometry buffer the results
+ * rotate through, have grown to the size of the scene, rebuilding a scene
+ * of that size makes no heap allocations. Profiler counters report the
+ * heap allocations of the process during each build (counted only in the
+ * interactive application, and including those of other threads) and the
+ * allocations reaching the upstream of the pool.
+ */
+class SceneBuilder
+{
+public:
+    static constexpr auto voronoi_hull_edge_length = 3.0f;
+
+    /**
+     * Computes the geometry for the input, copying only layers whose
+     * version differs from the one already in the geometry. cancelled() is
+     * polled between stages, concurrently by the parallel branches; once it
+     * returns true, false is returned and the geometry is left incomplete.
+     */
+    auto operator()(SceneInput const& input,
+                    SceneGeometry& geometry,
+                    std::function<bool()> const& cancelled) -> bool;
+
+    void reset();
+
+private:
+    using index_type = datastructure::Triangulation::index_type;
+    using edge_type = datastructure::Triangulation::edge_type;
+    using point_list = std::vector<glm::vec2>;
+    using index_list = std::vector<index_type>;
+
+    /**
+     * Line segments with their own, deduplicated vertices
+     */
+    struct IndexedLines
+    {
+        point_list vertices;
+        index_list indices;
+    };
+
+    struct AlphaShapeQuery
+    {
+        index_list triangle_indices;
+        index_list boundary_indices;
+    };
+
+    struct Graph
+    {
+        index_list indices;
+        float length = 0.0f;
+    };
+
+    concurrency::JobSystem* jobs_ = &concurrency::JobSystem::instance();
+
+    // Memory; declared first, as everything below allocates from it. The
+    // pool is synchronized, because parallel algorithms allocate from it on
+    // several threads.
+    memory::CountingResource heap_{ std::pmr::new_delete_resource() };
+    std::pmr::synchronized_pool_resource pool_{ &heap_ };
+
+    // Algorithms
+    algorithm::convex_hull::GiftWrapping gift_wrapping_;
+    algorithm::convex_hull::GrahamScan graham_scan_{ &pool_ };
+    algorithm::kd_tree::BuildKDTree2f build_kd_tree_{ &pool_ };
+    algorithm::triangulation::SweepLine sweep_line_{ &pool_ };
+    algorithm::triangulation::Delaunay delaunay_{ &pool_ };
+    algorithm::triangulation::DualGraph voronoi_{ voronoi_hull_edge_length,
+                                                  &pool_ };
+    algorithm::triangulation::IndexedDelaunay indexed_delaunay_{ &pool_,
+                                                                 *jobs_ };
+    algorithm::triangulation::VoronoiCells voronoi_cells_{ scene_bounds_min,
+                                                           scene_bounds_max,
+                                                           &pool_,
+                                                           *jobs_ };
+    algorithm::graph::EuclideanMST euclidean_mst_{ &pool_, *jobs_ };
+    algorithm::graph::ClosestPair closest_pair_{ &pool_, *jobs_ };
+    algorithm::triangulation::LloydRelaxation lloyd_relaxation_{
+        scene_bounds_min,
+        scene_bounds_max,
+        lloyd_convergence_threshold,
+        max_lloyd_iterations,
+        &pool_,
+        *jobs_,
+    };
+
+    using PolygonStage =
+        Stage<point_list, std::tuple<std::uint64_t, PolygonMode>>;
+    using PointListStage = Stage<point_list, std::uint64_t>;
+    using IndexListStage = Stage<index_list, std::uint64_t>;
+    using IndexedLinesStage = Stage<IndexedLines, std::uint64_t>;
+    using TriangulationStage =
+        Stage<datastructure::Triangulation, std::uint64_t>;
+    using AlphaShapeStage =
+        Stage<algorithm::triangulation::AlphaShape, std::uint64_t>;
+    using AlphaShapeQueryStage =
+        Stage<AlphaShapeQuery, std::tuple<std::uint64_t, float>>;
+    using GraphStage = Stage<Graph, std::tuple<std::uint64_t, GraphMode>>;
+    using KDTreeStage = Stage<datastructure::KDTree2f, std::uint64_t>;
+
+    // Stages
+    IndexListStage point_order_;
+    PolygonStage polygon_;
+    IndexListStage polygon_indices_;
+    IndexListStage sweep_line_triangles_;
+    PointListStage delaunay_triangles_;
+    IndexListStage delaunay_triangle_indices_;
+    IndexedLinesStage dual_graph_edges_;
+    TriangulationStage triangulation_;
+    IndexedLinesStage voronoi_cell_edges_;
+    AlphaShapeStage alpha_shape_{ std::in_place, &pool_, *jobs_ };
+    AlphaShapeQueryStage alpha_shape_query_;
+    GraphStage graph_;
+    KDTreeStage kd_tree_{ std::in_place, &pool_ };
+
+    // Scratch, separate per branch of the pipeline
+    point_list sweep_line_points_;
+    point_list voronoi_points_;
+    index_list voronoi_order_;
+    datastructure::PolygonSet voronoi_cell_polygons_;
+    std::pmr::vector<edge_type> alpha_shape_edges_{ &pool_ };
+    std::pmr::vector<edge_type> graph_edges_{ &pool_ };
+    std::pmr::vector<index_type> alpha_shape_triangles_{ &pool_ };
+    datastructure::Triangulation relaxation_triangulation_;
+
+    // Not a stage, because a cancelled relaxation leaves no output
+    RelaxedPoints relaxed_points_;
+
+    /**
+     * Indices of the input points, sorted by position
+     */
+    auto update_point_order(SceneInput const& input) -> IndexListStage const&;
+
+    auto update_polygon(SceneInput const& input) -> PolygonStage const&;
+
+    auto update_polygon_indices(SceneInput const& input)
+        -> IndexListStage const&;
+
+    auto update_sweep_line_triangles(SceneInput const& input)
+        -> IndexListStage const&;
+
+    auto update_delaunay_triangles(SceneInput const& input)
+        -> PointListStage const&;
+
+    auto update_delaunay_triangle_indices(SceneInput const& input)
+        -> IndexListStage const&;
+
+    auto update_dual_graph_edges(SceneInput const& input)
+        -> IndexedLinesStage const&;
+
+    auto update_triangulation(SceneInput const& input)
+        -> TriangulationStage const&;
+
+    auto update_voronoi_cell_edges(SceneInput const& input)
+        -> IndexedLinesStage const&;
+
+    auto update_alpha_shape(SceneInput const& input) -> AlphaShapeStage const&;
+
+    auto update_alpha_shape_query(SceneInput const& input)
+        -> AlphaShapeQueryStage const&;
+
+    auto update_graph(SceneInput const& input) -> GraphStage const&;
+
+    auto update_kd_tree(SceneInput const& input) -> KDTreeStage const&;
+
+    /**
+     * Appends the index of each point among the input points; every point
+     * must be one of the input points. Requires an up to date point order.
+     */
+    void find_indices(SceneInput const& input,
+                      std::span<glm::vec2 const> points,
+                      index_list& indices) const;
+
+    /**
+     * Replaces consecutive point pairs by indexed line segments
+     */
+    void weld_lines(std::span<glm::vec2 const> points, IndexedLines& lines);
+
+    /**
+     * Relaxes the points if the input requests it and copies the result to
+     * the geometry. Polls cancelled() between iterations and returns false
+     * once it returns true.
+     */
+    auto show_relaxed_points(SceneInput const& input,
+                             SceneGeometry& geometry,
+                             std::function<bool()> const& cancelled) -> bool;
+
+    // The show functions bring the stages of one branch of the pipeline up
+    // to date and copy their outputs to the geometry. They poll cancelled()
+    // between stages and return false once it returns true.
+    auto show_polygon(SceneInput const& input,
+                      SceneGeometry& geometry,
+                      std::function<bool()> const& cancelled) -> bool;
+
+    auto show_triangulation(SceneInput const& input,
+                            SceneGeometry& geometry,
+                            std::function<bool()> const& cancelled) -> bool;
+
+    auto show_graph(SceneInput const& input,
+                    SceneGeometry& geometry,
+                    std::function<bool()> const& cancelled) -> bool;
+
+    auto show_partitioning(SceneInput const& input,
+                           SceneGeometry& geometry,
+                           std::function<bool()> const& cancelled) -> bool;
+};
+
+} // namespace pa093::scene
@@ -0,0 +1,328 @@
+#include <pa093/scene/scene_editor.hpp>
+
+#include <algorithm>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+#include <gsl/gsl_assert>
+#include <spdlog/spdlog.h>
+
+namespace pa093::scene
+{
+
+SceneEditor::SceneEditor(std::uint64_t const seed)
+    : seed_{ seed }
+{
+}
+
+void
+SceneEditor::apply(SessionEvent const& event)
+{
+    if (auto const* const e = std::get_if<event::Seed>(&event))
+    {
+        seed(e->seed);
+    }
+    else if (auto const* const e = std::get_if<event::SetPoints>(&event))
+    {
+        set_points(e->points);
+    }
+    else if (auto const* const e = std::get_if<event::AddPoint>(&event))
+    {
+        add_point(e->position);
+    }
+    else if (auto const* const e = std::get_if<event::RemovePoint>(&event))
+    {
+        remove_point(e->index);
+    }
+    else if (auto const* const e = std::get_if<event::MovePoint>(&event))
+    {
+        move_point(e->index, e->position);
+    }
+    else if (std::holds_alternative<event::RemoveAllPoints>(event))
+    {
+        remove_all_points();
+    }
+    else if (auto const* const e = std::get_if<event::GeneratePoints>(&event))
+    {
+        generate_random_points(e->count, e->distribution);
+    }
+    else if (std::holds_alternative<event::RelaxPoints>(event))
+    {
+        relax_points();
+    }
+    else if (auto const* const e = std::get_if<event::SetSettings>(&event))
+    {
+        set_settings(e->settings);
+    }
+}
+
+void
+SceneEditor::seed(std::uint64_t const seed)
+{
+    seed_ = seed;
+    random_stream_position_ = 0u;
+    record(event::Seed{ seed });
+}
+
+void
+SceneEditor::set_points(std::vector<glm::vec2> const& points)
+{
+    mark_changed(0u, std::max(points_.size(), points.size()));
+    points_ = points;
+    record(event::SetPoints{ points });
+}
+
+void
+SceneEditor::add_point(glm::vec2 const position)
+{
+    spdlog::debug("Adding point at {0}, {1}", position.x, position.y);
+
+    points_.push_back(position);
+    mark_changed(points_.size() - 1u, points_.size());
+    record(event::AddPoint{ position });
+}
+
+void
+SceneEditor::remove_point(std::size_t const index)
+{
+    if (index >= points_.size())
+    {
+        throw std::out_of_range{ "Point index out of range" };
+    }
+
+    auto const point_iter =
+        points_.begin() + static_cast<std::ptrdiff_t>(index);
+    spdlog::debug("Removing point at {0}, {1}", point_iter->x, point_iter->y);
+
+    mark_changed(index, points_.size());
+    points_.erase(point_iter);
+    record(event::RemovePoint{ index });
+}
+
+void
+SceneEditor::move_point(std::size_t const index, glm::vec2 const position)
+{
+    if (points_.at(index) == position)
+    {
+        return;
+    }
+
+    points_[index] = position;
+    mark_changed(index, index + 1u);
+    record(event::MovePoint{ index, position });
+}
+
+void
+SceneEditor::remove_all_points()
+{
+    spdlog::debug("Removing all points");
+
+    mark_changed(0u, points_.size());
+    points_.clear();
+    record(event::RemoveAllPoints{});
+}
+
+void
+SceneEditor::generate_random_points(
+    std::size_t const count,
+    generator::PointDistribution const& distribution)
+{
+    spdlog::debug("Generating {0} {1} points",
+                  count,
+                  generator::distribution_name(distribution.distribution));
+
+    auto const first_new = points_.size();
+    points_.resize(first_new + count);
+    generator::generate_points(distribution,
+                               seed_,
+                               random_stream_position_,
+                               std::span{ points_ }.subspan(first_new));
+    random_stream_position_ += count;
+
+    mark_changed(first_new, points_.size());
+    record(event::GeneratePoints{ count, distribution });
+}
+
+void
+SceneEditor::relax_points()
+{
+    auto const iterations =
+        lloyd_relaxation_(points_, relaxation_triangulation_);
+    spdlog::debug("Relaxed {0} points in {1} iterations",
+                  points_.size(),
+                  iterations);
+
+    std::ranges::copy(relaxation_triangulation_.points(), points_.begin());
+    mark_changed(0u, points_.size());
+    record(event::RelaxPoints{});
+}
+
+void
+SceneEditor::request_relaxation()
+{
+    ++relaxation_;
+    relaxation_pending_ = true;
+
+    // Resubmits the input, even though neither the points nor the settings
+    // changed
+    settings_dirty_ = true;
+}
+
+void
+SceneEditor::finish_relaxation(RelaxedPoints const& relaxed)
+{
+    if (not relaxation_pending_ or relaxed.relaxation != relaxation_ or
+        relaxed.points_version != points_version_ or points_dirty_)
+    {
+        return;
+    }
+
+    relaxation_pending_ = false;
+
+    spdlog::debug("Relaxed {0} points in the background",
+                  relaxed.points.size());
+
+    Expects(relaxed.points.size() == points_.size());
+    std::ranges::copy(relaxed.points, points_.begin());
+    mark_changed(0u, points_.size());
+    record(event::RelaxPoints{});
+}
+
+void
+SceneEditor::set_settings(SceneSettings const& settings)
+{
+    if (std::exchange(settings_, settings) != settings)
+    {
+        settings_dirty_ = true;
+        record(event::SetSettings{ settings });
+    }
+}
+
+void
+SceneEditor::set_polygon_mode(PolygonMode const mode)
+{
+    auto settings = settings_;
+    settings.polygon_mode = mode;
+    set_settings(settings);
+}
+
+void
+SceneEditor::set_triangulation_mode(TriangulationMode const mode)
+{
+    auto settings = settings_;
+    settings.triangulation_mode = mode;
+    set_settings(settings);
+}
+
+void
+SceneEditor::set_graph_mode(GraphMode const mode)
+{
+    auto settings = settings_;
+    settings.graph_mode = mode;
+    set_settings(settings);
+}
+
+void
+SceneEditor::set_partitioning_mode(PartitioningMode const mode)
+{
+    auto settings = settings_;
+    settings.partitioning_mode = mode;
+    set_settings(settings);
+}
+
+void
+SceneEditor::set_alpha(float const alpha)
+{
+    auto settings = settings_;
+    settings.alpha = alpha;
+    set_settings(settings);
+}
+
+auto
+SceneEditor::end_frame() -> bool
+{
+    if (session_)
+    {
+        session_->end_frame();
+    }
+
+    if (std::exchange(points_dirty_, false))
+    {
+        auto const [begin, end] = std::exchange(pending_changed_points_, {});
+        changed_points_.end = std::min(end, points_.size());
+        changed_points_.begin = std::min(begin, changed_points_.end);
+
+        ++points_version_;
+        settings_dirty_ = false;
+        return true;
+    }
+
+    return std::exchange(settings_dirty_, false);
+}
+
+void
+SceneEditor::get_input(SceneInput& input) const
+{
+    input.points_version = points_version_;
+    input.points = points_;
+    input.settings = settings_;
+    input.relaxation = relaxation_pending_ ? relaxation_ : 0u;
+}
+
+void
+SceneEditor::start_recording(std::filesystem::path const& path)
+{
+    session_.emplace(path);
+
+    // Derive the new seed from the current stream, so that consecutive
+    // recordings do not repeat each other's random points
+    auto const new_seed =
+        generator::derive_seed(seed_, random_stream_position_);
+
+    seed(new_seed);
+    record(event::SetSettings{ settings_ });
+    record(event::SetPoints{ points_ });
+    session_->end_frame();
+
+    spdlog::info("Recording session to {0}", path.string());
+}
+
+void
+SceneEditor::stop_recording()
+{
+    if (session_)
+    {
+        spdlog::info("Stopped recording session to {0}",
+                     session_->path().string());
+
+        session_->end_frame();
+        session_.reset();
+    }
+}
+
+void
+SceneEditor::mark_changed(std::size_t const begin, std::size_t const end)
+{
+    auto& changed = pending_changed_points_;
+    if (not std::exchange(points_dirty_, true))
+    {
+        changed = { begin, end };
+    }
+    else
+    {
+        changed = { std::min(changed.begin, begin),
+                    std::max(changed.end, end) };
+    }
+}
+
+void
+SceneEditor::record(SessionEvent const& event)
+{
+    if (session_)
+    {
+        (*session_)(event);
+    }
+}
+
+} // namespace pa093::scene
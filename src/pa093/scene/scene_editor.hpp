@@ -0,0 +1,188 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <pa093/algorithm/triangulation/lloyd_relaxation.hpp>
+#include <pa093/datastructure/triangulation.hpp>
+#include <pa093/generator/point_generator.hpp>
+#include <pa093/scene/scene_geometry.hpp>
+#include <pa093/scene/scene_input.hpp>
+#include <pa093/scene/session.hpp>
+
+namespace pa093::scene
+{
+
+/**
+ * Half-open range [begin, end) of point indices
+ */
+struct PointRange
+{
+    std::size_t begin = 0u;
+    std::size_t end = 0u;
+};
+
+/**
+ * The editable state of a scene: its points and settings.
+ *
+ * Every edit can be recorded as a session event, and applying the recorded
+ * events to an editor reproduces the session, including randomly generated
+ * points, without a window.
+ */
+class SceneEditor
+{
+public:
+    explicit SceneEditor(std::uint64_t seed = 0u);
+
+    [[nodiscard]] auto points() const noexcept
+        -> std::vector<glm::vec2> const&
+    {
+        return points_;
+    }
+
+    /**
+     * Increases with every end_frame() that follows a change of the points
+     */
+    [[nodiscard]] auto points_version() const noexcept -> std::uint64_t
+    {
+        return points_version_;
+    }
+
+    /**
+     * Indices of the points that changed in the frame closed by the last
+     * end_frame() that bumped points_version(). Points outside the range
+     * are unchanged since the previous version.
+     */
+    [[nodiscard]] auto changed_points() const noexcept -> PointRange
+    {
+        return changed_points_;
+    }
+
+    [[nodiscard]] auto settings() const noexcept -> SceneSettings const&
+    {
+        return settings_;
+    }
+
+    /**
+     * Performs a recorded edit. EndFrame events are ignored; the caller
+     * decides when to call end_frame().
+     */
+    void apply(SessionEvent const& event);
+
+    void seed(std::uint64_t seed);
+
+    void set_points(std::vector<glm::vec2> const& points);
+
+    void add_point(glm::vec2 position);
+
+    void remove_point(std::size_t index);
+
+    void move_point(std::size_t index, glm::vec2 position);
+
+    void remove_all_points();
+
+    /**
+     * Appends the next count points of the random stream of the seed
+     */
+    void generate_random_points(
+        std::size_t count,
+        generator::PointDistribution const& distribution = {});
+
+    /**
+     * Moves the points by a Lloyd relaxation, computed on the calling
+     * thread
+     */
+    void relax_points();
+
+    /**
+     * Requests a Lloyd relaxation of the points from the scene builder,
+     * through the next inputs. The relaxed points are applied by
+     * finish_relaxation(); edits of the points in the meantime restart the
+     * relaxation from the edited points.
+     */
+    void request_relaxation();
+
+    [[nodiscard]] auto relaxation_pending() const noexcept -> bool
+    {
+        return relaxation_pending_;
+    }
+
+    /**
+     * Replaces the points by relaxed points computed by the scene builder,
+     * if they answer the pending request and were relaxed from the current
+     * points; records the edit like relax_points()
+     */
+    void finish_relaxation(RelaxedPoints const& relaxed);
+
+    void set_settings(SceneSettings const& settings);
+
+    void set_polygon_mode(PolygonMode mode);
+
+    void set_triangulation_mode(TriangulationMode mode);
+
+    void set_graph_mode(GraphMode mode);
+
+    void set_partitioning_mode(PartitioningMode mode);
+
+    void set_alpha(float alpha);
+
+    /**
+     * Closes the current frame. Returns whether the points or settings
+     * changed since the previous frame, i.e. whether the scene has to be
+     * recomputed.
+     */
+    auto end_frame() -> bool;
+
+    /**
+     * Fills the input with the current points and settings
+     */
+    void get_input(SceneInput& input) const;
+
+    /**
+     * Starts writing all further edits to a session file, beginning with a
+     * snapshot of the current state and a fresh seed
+     */
+    void start_recording(std::filesystem::path const& path);
+
+    void stop_recording();
+
+    [[nodiscard]] auto recording() const noexcept -> bool
+    {
+        return session_.has_value();
+    }
+
+private:
+    algorithm::triangulation::LloydRelaxation lloyd_relaxation_{
+        scene_bounds_min,
+        scene_bounds_max,
+        lloyd_convergence_threshold,
+        max_lloyd_iterations,
+    };
+    datastructure::Triangulation relaxation_triangulation_;
+
+    std::uint64_t seed_;
+    // Index of the next point in the random stream of the seed
+    std::uint64_t random_stream_position_ = 0u;
+    std::vector<glm::vec2> points_;
+    std::uint64_t points_version_ = 0u;
+    PointRange pending_changed_points_;
+    PointRange changed_points_;
+    SceneSettings settings_;
+    bool points_dirty_ = false;
+    bool settings_dirty_ = false;
+    // Identifies the latest relaxation request
+    std::uint64_t relaxation_ = 0u;
+    bool relaxation_pending_ = false;
+    std::optional<SessionWriter> session_;
+
+    void mark_changed(std::size_t begin, std::size_t end);
+
+    void record(SessionEvent const& event);
+};
+
+} // namespace pa093::scene
@@ -0,0 +1,25 @@
+#include <pa093/scene/scene_geometry.hpp>
+
+namespace pa093::scene
+{
+
+void
+SceneGeometry::clear()
+{
+    points.clear();
+    voronoi_vertices.clear();
+    polygon.clear();
+    triangles.clear();
+    graph.clear();
+    alpha_shape_boundary.clear();
+    voronoi.clear();
+    kd_tree.clear();
+    kd_tree_version = 0u;
+    num_graph_edges = 0u;
+    graph_length = 0.0f;
+    num_alpha_shape_triangles = 0u;
+    num_alpha_shape_boundary_edges = 0u;
+    relaxed_points.clear();
+}
+
+} // namespace pa093::scene
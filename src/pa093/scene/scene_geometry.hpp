@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <pa093/datastructure/kd_tree.hpp>
+#include <pa093/scene/scene_input.hpp>
+
+namespace pa093::scene
+{
+
+/**
+ * Vertices shared by drawable layers, tagged with the version of the data
+ * they were copied from (0 if empty), so that consumers can skip uploads of
+ * vertices that did not change.
+ */
+struct GeometryVertices
+{
+    std::uint64_t version = 0u;
+    std::vector<glm::vec2> points;
+
+    void assign(std::uint64_t const new_version,
+                std::span<glm::vec2 const> const new_points)
+    {
+        if (version != new_version)
+        {
+            points.assign(new_points.begin(), new_points.end());
+            version = new_version;
+        }
+    }
+
+    void clear()
+    {
+        points.clear();
+        version = 0u;
+    }
+};
+
+/**
+ * Vertex indices of one drawable layer, tagged like GeometryVertices with
+ * the version of the stage output they were copied from
+ */
+struct GeometryLayer
+{
+    std::uint64_t version = 0u;
+    std::vector<std::uint32_t> indices;
+
+    void assign(std::uint64_t const new_version,
+                std::span<std::uint32_t const> const new_indices)
+    {
+        if (version != new_version)
+        {
+            indices.assign(new_indices.begin(), new_indices.end());
+            version = new_version;
+        }
+    }
+
+    void clear()
+    {
+        indices.clear();
+        version = 0u;
+    }
+};
+
+/**
+ * Points relaxed by Lloyd's algorithm, tagged with the relaxation request
+ * of the input and the version of the points they were relaxed from (0 if
+ * empty)
+ */
+struct RelaxedPoints
+{
+    std::uint64_t relaxation = 0u;
+    std::uint64_t points_version = 0u;
+    std::vector<glm::vec2> points;
+
+    void clear()
+    {
+        points.clear();
+        relaxation = 0u;
+        points_version = 0u;
+    }
+};
+
+/**
+ * Renderable results computed from a SceneInput
+ */
+struct SceneGeometry
+{
+    /**
+     * Generation of the input these results were computed from
+     */
+    std::uint64_t generation = 0u;
+    SceneSettings settings;
+
+    /**
+     * The input points the geometry was computed from, versioned by the
+     * input points version
+     */
+    GeometryVertices points;
+    GeometryVertices voronoi_vertices;
+
+    // Index the points
+    GeometryLayer polygon; // Line loop
+    GeometryLayer triangles;
+    GeometryLayer graph; // Lines
+    GeometryLayer alpha_shape_boundary; // Lines
+
+    // Index the Voronoi vertices
+    GeometryLayer voronoi; // Lines
+
+    datastructure::KDTree2f kd_tree;
+    std::uint64_t kd_tree_version = 0u;
+
+    std::size_t num_graph_edges = 0u;
+    float graph_length = 0.0f;
+    std::size_t num_alpha_shape_triangles = 0u;
+    std::size_t num_alpha_shape_boundary_edges = 0u;
+
+    /**
+     * Answer to the relaxation request of the input, if any; the points
+     * are not drawn, but replace the scene points
+     */
+    RelaxedPoints relaxed_points;
+
+    void clear();
+};
+
+} // namespace pa093::scene
@@ -0,0 +1 @@
+#include <pa093/scene/scene_input.hpp>
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace pa093::scene
+{
+
+/**
+ * Visible region of the scene
+ */
+inline constexpr auto scene_bounds_min = glm::vec2(-1.0f);
+inline constexpr auto scene_bounds_max = glm::vec2(1.0f);
+
+/**
+ * Lloyd relaxation of the scene points, clipped to the scene bounds
+ */
+inline constexpr auto lloyd_convergence_threshold = 1e-4f;
+inline constexpr auto max_lloyd_iterations = std::size_t{ 100 };
+
+enum class PolygonMode : int
+{
+    none = 0,
+    all_points,
+    gift_wrapping_convex_hull,
+    graham_scan_convex_hull,
+};
+
+enum class TriangulationMode : int
+{
+    none = 0,
+    sweep_line,
+    delaunay,
+    delaunay_plus_voronoi,
+    delaunay_plus_voronoi_cells,
+    alpha_shape,
+};
+
+enum class GraphMode : int
+{
+    none = 0,
+    euclidean_mst,
+    closest_pair,
+};
+
+enum class PartitioningMode : int
+{
+    none = 0,
+    kd_tree,
+};
+
+struct SceneSettings
+{
+    PolygonMode polygon_mode = PolygonMode::none;
+    TriangulationMode triangulation_mode = TriangulationMode::none;
+    GraphMode graph_mode = GraphMode::none;
+    PartitioningMode partitioning_mode = PartitioningMode::none;
+    float alpha = 0.1f;
+
+    [[nodiscard]] auto operator==(SceneSettings const&) const
+        -> bool = default;
+};
+
+/**
+ * Snapshot of everything the scene geometry is computed from
+ */
+struct SceneInput
+{
+    /**
+     * Increases with every submitted input
+     */
+    std::uint64_t generation = 0u;
+    /**
+     * Increases with every change of the points, so that results derived
+     * only from the points can be reused
+     */
+    std::uint64_t points_version = 0u;
+    std::vector<glm::vec2> points;
+    SceneSettings settings;
+    /**
+     * Nonzero to request a Lloyd relaxation of the points, different for
+     * every request
+     */
+    std::uint64_t relaxation = 0u;
+};
+
+} // namespace pa093::scene
@@ -0,0 +1,80 @@
+#include <pa093/scene/scene_worker.hpp>
+
+#include <exception>
+#include <utility>
+
+#include <spdlog/spdlog.h>
+
+namespace pa093::scene
+{
+
+SceneWorker::SceneWorker(std::function<void()> on_completed)
+    : on_completed_{ std::move(on_completed) }
+    , thread_{ [this](std::stop_token const stop) { run(stop); } }
+{
+}
+
+void
+SceneWorker::submit()
+{
+    submitted_generation_.store(inputs_.back().generation,
+                                std::memory_order_relaxed);
+    inputs_.publish();
+
+    // Synchronize with the worker's check of the wake condition, so that
+    // the notification cannot be lost
+    {
+        auto const lock = std::lock_guard{ wake_mutex_ };
+    }
+    wake_.notify_one();
+}
+
+void
+SceneWorker::run(std::stop_token const& stop)
+{
+    while (true)
+    {
+        {
+            auto lock = std::unique_lock{ wake_mutex_ };
+            if (not wake_.wait(lock, stop, [&] { return inputs_.updated(); }))
+            {
+                return;
+            }
+        }
+
+        inputs_.acquire();
+        auto const& input = inputs_.front();
+        auto const cancelled = [&]
+        {
+            return stop.stop_requested() or
+                   submitted_generation_.load(std::memory_order_relaxed) !=
+                       input.generation;
+        };
+
+        try
+        {
+            if (builder_(input, results_.back(), cancelled))
+            {
+                results_.publish();
+                completed_generation_.store(input.generation,
+                                            std::memory_order_relaxed);
+
+                if (on_completed_)
+                {
+                    on_completed_();
+                }
+            }
+        }
+        catch (std::exception const& error)
+        {
+            spdlog::error("Scene computation failed: {0}", error.what());
+
+            // Cached results may be inconsistent after an exception
+            builder_.reset();
+            completed_generation_.store(input.generation,
+                                        std::memory_order_relaxed);
+        }
+    }
+}
+
+} // namespace pa093::scene
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+
+#include <pa093/concurrency/triple_buffer.hpp>
+#include <pa093/scene/scene_builder.hpp>
+#include <pa093/scene/scene_geometry.hpp>
+#include <pa093/scene/scene_input.hpp>
+
+namespace pa093::scene
+{
+
+/**
+ * Computes scene geometry on a background thread.
+ *
+ * Inputs and results are exchanged through triple buffers, so neither the
+ * submitting thread nor the worker ever waits for the other. Submitting a
+ * new input cancels the job in progress at the next algorithm boundary.
+ * An optional callback lets an event-driven submitter sleep until a result
+ * is ready.
+ */
+class SceneWorker
+{
+public:
+    /**
+     * on_completed is called on the worker thread after each published
+     * result
+     */
+    explicit SceneWorker(std::function<void()> on_completed = {});
+
+    SceneWorker(SceneWorker const&) = delete;
+    auto operator=(SceneWorker const&) -> SceneWorker& = delete;
+
+    /**
+     * Input to be filled before calling submit()
+     */
+    [[nodiscard]] auto input() noexcept -> SceneInput&
+    {
+        return inputs_.back();
+    }
+
+    /**
+     * Queues the input for computation, superseding any earlier input; its
+     * generation must be greater than that of earlier inputs.
+     */
+    void submit();
+
+    /**
+     * Takes the latest completed result as geometry(); returns false if
+     * nothing was completed since the last call.
+     */
+    auto poll() noexcept -> bool { return results_.acquire(); }
+
+    /**
+     * The result taken by the last successful poll()
+     */
+    [[nodiscard]] auto geometry() const noexcept -> SceneGeometry const&
+    {
+        return results_.front();
+    }
+
+    /**
+     * Whether the last submitted input has not been completed yet
+     */
+    [[nodiscard]] auto busy() const noexcept -> bool
+    {
+        return completed_generation_.load(std::memory_order_relaxed) !=
+               submitted_generation_.load(std::memory_order_relaxed);
+    }
+
+private:
+    concurrency::TripleBuffer<SceneInput> inputs_;
+    concurrency::TripleBuffer<SceneGeometry> results_;
+    SceneBuilder builder_;
+    std::atomic<std::uint64_t> submitted_generation_ = 0u;
+    std::atomic<std::uint64_t> completed_generation_ = 0u;
+    std::mutex wake_mutex_;
+    std::condition_variable_any wake_;
+    std::function<void()> on_completed_;
+    // Declared last, so that the thread stops before the state it uses
+    // is destroyed
+    std::jthread thread_;
+
+    void run(std::stop_token const& stop);
+};
+
+} // namespace pa093::scene
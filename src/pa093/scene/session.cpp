@@ -0,0 +1,292 @@
+#include <pa093/scene/session.hpp>
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <fmt/format.h>
+
+namespace pa093::scene
+{
+
+namespace
+{
+
+constexpr auto session_magic = "pa093-session";
+// Version 2 generates points with a counter-based generator, so version 1
+// sessions would not reproduce their random points
+constexpr auto session_format_version = 2;
+
+template<typename... Fs>
+struct Overloaded : Fs...
+{
+    using Fs::operator()...;
+};
+
+template<typename... Fs>
+Overloaded(Fs...) -> Overloaded<Fs...>;
+
+template<typename T>
+void
+read_value(std::istringstream& line,
+           T& value,
+           std::filesystem::path const& path,
+           std::size_t const line_number)
+{
+    if (not(line >> value))
+    {
+        throw std::runtime_error{ fmt::format(
+            "Malformed session file {}, line {}", path.string(), line_number) };
+    }
+}
+
+template<typename E>
+auto
+read_mode(std::istringstream& line,
+          std::filesystem::path const& path,
+          std::size_t const line_number) -> E
+{
+    auto value = 0;
+    read_value(line, value, path, line_number);
+    return static_cast<E>(value);
+}
+
+} // namespace
+
+SessionWriter::SessionWriter(std::filesystem::path const& path)
+    : path_{ path }
+    , file_{ path }
+{
+    if (not(file_ << fmt::format(
+                "{} {}\n", session_magic, session_format_version)))
+    {
+        throw std::runtime_error{ fmt::format("Cannot write session file {}",
+                                              path.string()) };
+    }
+}
+
+void
+SessionWriter::operator()(SessionEvent const& event)
+{
+    if (std::holds_alternative<event::EndFrame>(event))
+    {
+        end_frame();
+        return;
+    }
+
+    file_ << std::visit(
+        Overloaded{
+            [](event::EndFrame) { return std::string{}; },
+            [](event::Seed const& e)
+            { return fmt::format("seed {}\n", e.seed); },
+            [](event::SetPoints const& e)
+            {
+                auto line = fmt::format("points {}\n", e.points.size());
+                for (auto const point : e.points)
+                {
+                    line += fmt::format("{} {}\n", point.x, point.y);
+                }
+                return line;
+            },
+            [](event::AddPoint const& e)
+            { return fmt::format("add {} {}\n", e.position.x, e.position.y); },
+            [](event::RemovePoint const& e)
+            { return fmt::format("remove {}\n", e.index); },
+            [](event::MovePoint const& e)
+            {
+                return fmt::format(
+                    "move {} {} {}\n", e.index, e.position.x, e.position.y);
+            },
+            [](event::RemoveAllPoints) { return std::string{ "clear\n" }; },
+            [](event::GeneratePoints const& e)
+            {
+                auto const& d = e.distribution;
+                return fmt::format("generate {} {} {} {} {} {} {} {}\n",
+                                   e.count,
+                                   static_cast<int>(d.distribution),
+                                   d.num_clusters,
+                                   d.cluster_sigma,
+                                   d.inner_radius,
+                                   d.outer_radius,
+                                   d.grid_size,
+                                   d.grid_jitter);
+            },
+            [](event::RelaxPoints) { return std::string{ "relax\n" }; },
+            [](event::SetSettings const& e)
+            {
+                auto const& s = e.settings;
+                return fmt::format("settings {} {} {} {} {}\n",
+                                   static_cast<int>(s.polygon_mode),
+                                   static_cast<int>(s.triangulation_mode),
+                                   static_cast<int>(s.graph_mode),
+                                   static_cast<int>(s.partitioning_mode),
+                                   s.alpha);
+            },
+        },
+        event);
+
+    frame_pending_ = true;
+}
+
+void
+SessionWriter::end_frame()
+{
+    if (std::exchange(frame_pending_, false))
+    {
+        // Flushed per frame, so that a crash loses at most the last frame
+        file_ << "frame\n" << std::flush;
+    }
+}
+
+auto
+read_session(std::filesystem::path const& path) -> std::vector<SessionEvent>
+{
+    auto file = std::ifstream{ path };
+    if (not file)
+    {
+        throw std::runtime_error{ fmt::format("Cannot open session file {}",
+                                              path.string()) };
+    }
+
+    auto magic = std::string{};
+    auto version = 0;
+    if (not(file >> magic >> version) or magic != session_magic or
+        version != session_format_version)
+    {
+        throw std::runtime_error{ fmt::format(
+            "{} is not a session file (version {})",
+            path.string(),
+            session_format_version) };
+    }
+
+    auto events = std::vector<SessionEvent>{};
+    auto text = std::string{};
+    auto line_number = std::size_t{ 1 };
+    std::getline(file, text);
+
+    while (std::getline(file, text))
+    {
+        ++line_number;
+
+        auto line = std::istringstream{ text };
+        auto name = std::string{};
+        if (not(line >> name))
+        {
+            continue;
+        }
+
+        auto const read = [&](auto& value)
+        { read_value(line, value, path, line_number); };
+
+        if (name == "frame")
+        {
+            events.emplace_back(event::EndFrame{});
+        }
+        else if (name == "seed")
+        {
+            auto e = event::Seed{};
+            read(e.seed);
+            events.emplace_back(e);
+        }
+        else if (name == "points")
+        {
+            auto count = std::size_t{ 0 };
+            read(count);
+
+            auto e = event::SetPoints{};
+            e.points.resize(count);
+            for (auto& point : e.points)
+            {
+                ++line_number;
+                if (not(file >> point.x >> point.y))
+                {
+                    throw std::runtime_error{ fmt::format(
+                        "Malformed session file {}, line {}",
+                        path.string(),
+                        line_number) };
+                }
+            }
+            std::getline(file, text);
+
+            events.emplace_back(std::move(e));
+        }
+        else if (name == "add")
+        {
+            auto e = event::AddPoint{};
+            read(e.position.x);
+            read(e.position.y);
+            events.emplace_back(e);
+        }
+        else if (name == "remove")
+        {
+            auto e = event::RemovePoint{};
+            read(e.index);
+            events.emplace_back(e);
+        }
+        else if (name == "move")
+        {
+            auto e = event::MovePoint{};
+            read(e.index);
+            read(e.position.x);
+            read(e.position.y);
+            events.emplace_back(e);
+        }
+        else if (name == "clear")
+        {
+            events.emplace_back(event::RemoveAllPoints{});
+        }
+        else if (name == "generate")
+        {
+            auto e = event::GeneratePoints{};
+            auto& d = e.distribution;
+            read(e.count);
+            d.distribution =
+                read_mode<generator::Distribution>(line, path, line_number);
+            read(d.num_clusters);
+            read(d.cluster_sigma);
+            read(d.inner_radius);
+            read(d.outer_radius);
+            read(d.grid_size);
+            read(d.grid_jitter);
+            if (not d.valid())
+            {
+                throw std::runtime_error{ fmt::format(
+                    "Invalid point distribution in {}, line {}",
+                    path.string(),
+                    line_number) };
+            }
+            events.emplace_back(e);
+        }
+        else if (name == "relax")
+        {
+            events.emplace_back(event::RelaxPoints{});
+        }
+        else if (name == "settings")
+        {
+            auto e = event::SetSettings{};
+            e.settings.polygon_mode =
+                read_mode<PolygonMode>(line, path, line_number);
+            e.settings.triangulation_mode =
+                read_mode<TriangulationMode>(line, path, line_number);
+            e.settings.graph_mode =
+                read_mode<GraphMode>(line, path, line_number);
+            e.settings.partitioning_mode =
+                read_mode<PartitioningMode>(line, path, line_number);
+            read(e.settings.alpha);
+            events.emplace_back(e);
+        }
+        else
+        {
+            throw std::runtime_error{ fmt::format(
+                "Unknown session event {} in {}, line {}",
+                name,
+                path.string(),
+                line_number) };
+        }
+    }
+
+    return events;
+}
+
+} // namespace pa093::scene
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <variant>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <pa093/generator/point_generator.hpp>
+#include <pa093/scene/scene_input.hpp>
+
+namespace pa093::scene
+{
+
+/**
+ * Edits of a recorded interactive session, see SceneEditor
+ */
+namespace event
+{
+
+/**
+ * Marks the end of a frame in which at least one other event occurred
+ */
+struct EndFrame
+{
+};
+
+/**
+ * Reseeds the random stream of generated points and restarts it
+ */
+struct Seed
+{
+    std::uint64_t seed = 0u;
+};
+
+/**
+ * Replaces all points; written when recording starts mid-session
+ */
+struct SetPoints
+{
+    std::vector<glm::vec2> points;
+};
+
+struct AddPoint
+{
+    glm::vec2 position = {};
+};
+
+struct RemovePoint
+{
+    std::size_t index = 0u;
+};
+
+struct MovePoint
+{
+    std::size_t index = 0u;
+    glm::vec2 position = {};
+};
+
+struct RemoveAllPoints
+{
+};
+
+struct GeneratePoints
+{
+    std::size_t count = 0u;
+    generator::PointDistribution distribution;
+};
+
+struct RelaxPoints
+{
+};
+
+struct SetSettings
+{
+    SceneSettings settings;
+};
+
+} // namespace event
+
+using SessionEvent = std::variant<event::EndFrame,
+                                  event::Seed,
+                                  event::SetPoints,
+                                  event::AddPoint,
+                                  event::RemovePoint,
+                                  event::MovePoint,
+                                  event::RemoveAllPoints,
+                                  event::GeneratePoints,
+                                  event::RelaxPoints,
+                                  event::SetSettings>;
+
+/**
+ * Writes session events as a line based text file.
+ *
+ * Coordinates are written in their shortest round-trip form, so replaying a
+ * session reproduces the recorded points exactly. Frames without events are
+ * not written.
+ */
+class SessionWriter
+{
+public:
+    explicit SessionWriter(std::filesystem::path const& path);
+
+    void operator()(SessionEvent const& event);
+
+    /**
+     * Writes an EndFrame if any event was written since the last one
+     */
+    void end_frame();
+
+    [[nodiscard]] auto path() const noexcept -> std::filesystem::path const&
+    {
+        return path_;
+    }
+
+private:
+    std::filesystem::path path_;
+    std::ofstream file_;
+    bool frame_pending_ = false;
+};
+
+/**
+ * Reads a file written by SessionWriter. Throws std::runtime_error on
+ * malformed input.
+ */
+[[nodiscard]] auto
+read_session(std::filesystem::path const& path) -> std::vector<SessionEvent>;
+
+} // namespace pa093::scene
@@ -0,0 +1,15 @@
+#include <pa093/scene/stage.hpp>
+
+#include <atomic>
+
+namespace pa093::scene
+{
+
+auto
+next_stage_version() noexcept -> std::uint64_t
+{
+    static auto counter = std::atomic<std::uint64_t>{ 0u };
+    return counter.fetch_add(1u, std::memory_order_relaxed) + 1u;
+}
+
+} // namespace pa093::scene
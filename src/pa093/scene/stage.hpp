@@ -0,0 +1,88 @@
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <utility>
+
+namespace pa093::scene
+{
+
+/**
+ * Next value of a counter shared by all stages, so that a version identifies
+ * the output of one stage computation. Never returns 0.
+ */
+[[nodiscard]] auto
+next_stage_version() noexcept -> std::uint64_t;
+
+/**
+ * Cached output of a scene pipeline stage.
+ *
+ * The output is only recomputed if the key (versions of the stage inputs
+ * and the settings the stage depends on) differs from the key it was last
+ * computed with. Each computation assigns a new version, which dependent
+ * stages use in their keys.
+ */
+template<typename T, std::equality_comparable Key>
+class Stage
+{
+public:
+    using output_type = T;
+    using key_type = Key;
+
+    Stage() = default;
+
+    /**
+     * Constructs the output from the arguments, e.g. a memory resource for
+     * outputs that allocate
+     */
+    template<typename... Args>
+    requires std::constructible_from<T, Args...>
+    [[nodiscard]] explicit Stage(std::in_place_t, Args&&... args)
+        : output_(std::forward<Args>(args)...)
+    {
+    }
+
+    [[nodiscard]] auto output() const noexcept -> T const& { return output_; }
+
+    /**
+     * Version of the current output; 0 if it was never computed
+     */
+    [[nodiscard]] auto version() const noexcept -> std::uint64_t
+    {
+        return version_;
+    }
+
+    /**
+     * Calls compute(output) unless the output is up to date with the key.
+     * Returns the version of the resulting output.
+     */
+    template<std::invocable<T&> F>
+    auto update(Key const& key, F&& compute) -> std::uint64_t
+    {
+        if (key_ != key)
+        {
+            // Stays invalid if the computation throws
+            key_.reset();
+            std::invoke(std::forward<F>(compute), output_);
+            key_ = key;
+            version_ = next_stage_version();
+        }
+
+        return version_;
+    }
+
+    void reset()
+    {
+        key_.reset();
+        version_ = 0u;
+    }
+
+private:
+    T output_{};
+    std::optional<Key> key_ = std::nullopt;
+    std::uint64_t version_ = 0u;
+};
+
+} // namespace pa093::scene
@@ -12,17 +12,29 @@
 namespace pa093::visualization
 {
 
+/**
+ * Split lines of a k-D tree. Subtrees are only descended while their cells
+ * are wide enough in the split dimension to tell the lines apart on screen,
+ * so the number of lines is bounded by the framebuffer resolution rather
+ * than by the size of the tree.
+ */
 class KDTree
 {
 public:
+    static constexpr auto min_split_spacing_pixels = 4.0f;
+
     explicit KDTree(render::ShaderCache& shader_cache)
         : horizontal_lines_mesh_{ shader_cache }
         , vertical_lines_mesh_{ shader_cache }
     {
     }
 
-    void set_tree(datastructure::KDTree2f const& tree)
+    void set_tree(datastructure::KDTree2f const& tree,
+                  glm::vec2 const framebuffer_size)
     {
+        // The view spans [-1, 1] in both dimensions
+        min_split_spacing_ = 2.0f * min_split_spacing_pixels / framebuffer_size;
+
         horizontal_line_points_.clear();
         vertical_line_points_.clear();
 
@@ -57,6 +69,7 @@ private:
     render::DynamicMesh2d vertical_lines_mesh_;
     std::vector<glm::vec2> horizontal_line_points_;
     std::vector<glm::vec2> vertical_line_points_;
+    glm::vec2 min_split_spacing_ = {};
 
     void visit_subtree(datastructure::KDTree2f const& tree,
                        datastructure::KDTree2f::node_id_type const node_id,
@@ -72,6 +85,12 @@ private:
         auto const& node = tree.node(node_id);
         auto const current_dim = static_cast<int>(depth % 2u);
 
+        if (max[current_dim] - min[current_dim] <
+            min_split_spacing_[current_dim])
+        {
+            return;
+        }
+
         // Create the dividing line
         auto line_start = min;
         line_start[current_dim] = node.pivot;
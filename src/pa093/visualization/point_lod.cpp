@@ -0,0 +1,137 @@
+#include <pa093/visualization/point_lod.hpp>
+
+#include <algorithm>
+
+#include <gsl/gsl_assert>
+
+#include <pa093/profiling/profiler.hpp>
+
+namespace pa093::visualization
+{
+
+void
+PointLod::set_points(std::span<glm::vec2 const> const points,
+                     glm::vec2 const framebuffer_size)
+{
+    PA093_PROFILE_SCOPE("Point LOD");
+
+    grid_size_ = glm::max(
+        glm::ivec2(glm::ceil(framebuffer_size / cell_size_pixels)),
+        glm::ivec2(1));
+
+    auto const num_cells = static_cast<std::size_t>(grid_size_.x) *
+                           static_cast<std::size_t>(grid_size_.y);
+    Expects(num_cells < no_cell);
+
+    cell_counts_.assign(num_cells, 0u);
+    cell_representatives_.resize(num_cells);
+    representative_cells_.clear();
+    representatives_.clear();
+
+    point_cells_.resize(points.size());
+    for (auto i = std::size_t{ 0 }; i < points.size(); ++i)
+    {
+        point_cells_[i] = cell_of(points[i]);
+        add_point(points[i], point_cells_[i]);
+    }
+
+    PA093_PROFILE_COUNTER("LOD points", representatives_.size());
+
+    mesh_.set_vertex_positions(representatives_);
+}
+
+void
+PointLod::update_points(std::span<glm::vec2 const> const points,
+                        glm::vec2 const framebuffer_size,
+                        std::size_t const first_changed,
+                        std::size_t const end_changed)
+{
+    auto const grid_size = glm::max(
+        glm::ivec2(glm::ceil(framebuffer_size / cell_size_pixels)),
+        glm::ivec2(1));
+
+    if (grid_size != grid_size_)
+    {
+        set_points(points, framebuffer_size);
+        return;
+    }
+
+    PA093_PROFILE_SCOPE("Point LOD");
+
+    // Indices shift when points are added or removed in between
+    auto const old_size = point_cells_.size();
+    auto const end = points.size() == old_size
+                         ? std::min(end_changed, old_size)
+                         : std::max(points.size(), old_size);
+
+    for (auto i = first_changed; i < std::min(end, old_size); ++i)
+    {
+        remove_point(point_cells_[i]);
+    }
+
+    point_cells_.resize(points.size());
+    for (auto i = first_changed; i < std::min(end, points.size()); ++i)
+    {
+        point_cells_[i] = cell_of(points[i]);
+        add_point(points[i], point_cells_[i]);
+    }
+
+    PA093_PROFILE_COUNTER("LOD points", representatives_.size());
+
+    // Bounded by the framebuffer resolution, not the number of points
+    mesh_.set_vertex_positions(representatives_);
+}
+
+auto
+PointLod::cell_of(glm::vec2 const point) const noexcept -> std::uint32_t
+{
+    // The view spans [-1, 1] in both dimensions; written so that NaN
+    // coordinates are outside
+    if (not(point.x >= -1.0f and point.y >= -1.0f and point.x <= 1.0f and
+            point.y <= 1.0f))
+    {
+        return no_cell;
+    }
+
+    // Points on the top and right edges belong to the last cells
+    auto const to_cell = glm::vec2(grid_size_) / 2.0f;
+    auto const cell = glm::min(glm::ivec2(glm::floor((point + 1.0f) * to_cell)),
+                               grid_size_ - 1);
+
+    return static_cast<std::uint32_t>(cell.y * grid_size_.x + cell.x);
+}
+
+void
+PointLod::add_point(glm::vec2 const point, std::uint32_t const cell)
+{
+    if (cell == no_cell or cell_counts_[cell]++ > 0u)
+    {
+        return;
+    }
+
+    cell_representatives_[cell] =
+        static_cast<std::uint32_t>(representatives_.size());
+    representative_cells_.push_back(cell);
+    representatives_.push_back(point);
+}
+
+void
+PointLod::remove_point(std::uint32_t const cell)
+{
+    if (cell == no_cell or --cell_counts_[cell] > 0u)
+    {
+        return;
+    }
+
+    auto const representative = cell_representatives_[cell];
+    auto const last_cell = representative_cells_.back();
+
+    representatives_[representative] = representatives_.back();
+    representative_cells_[representative] = last_cell;
+    cell_representatives_[last_cell] = representative;
+
+    representatives_.pop_back();
+    representative_cells_.pop_back();
+}
+
+} // namespace pa093::visualization
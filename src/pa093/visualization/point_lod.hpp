@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <pa093/render/mesh.hpp>
+#include <pa093/render/shader_cache.hpp>
+
+namespace pa093::visualization
+{
+
+/**
+ * Level of detail for drawing large point sets.
+ *
+ * Bins the points into a grid of screen-space cells over the view and keeps
+ * one representative point per occupied cell, so the number of points drawn
+ * is bounded by the framebuffer resolution instead of the size of the set.
+ * Points outside the view are dropped.
+ *
+ * The cell of every point and the number of points in every cell are kept,
+ * so that a change of a few points updates the level of detail in time
+ * proportional to the number of changed points.
+ */
+class PointLod
+{
+public:
+    /**
+     * Size of a grid cell; well below the drawn point size, so that the
+     * representatives cover the same pixels as all the points would
+     */
+    static constexpr auto cell_size_pixels = 2.0f;
+
+    explicit PointLod(render::ShaderCache& shader_cache)
+        : mesh_{ shader_cache, render::DynamicMesh2d::VertexFormat::unorm16 }
+    {
+    }
+
+    void set_points(std::span<glm::vec2 const> points,
+                    glm::vec2 framebuffer_size);
+
+    /**
+     * Replaces the points, given that only those in
+     * [first_changed, end_changed) differ from the previous points. If the
+     * number of points changed, all points from first_changed on are
+     * treated as changed. Rebuilds everything if the framebuffer size
+     * changed.
+     *
+     * A representative keeps its position while its cell stays occupied,
+     * even if the point it was taken from moved away; it still lies in the
+     * cell.
+     */
+    void update_points(std::span<glm::vec2 const> points,
+                       glm::vec2 framebuffer_size,
+                       std::size_t first_changed,
+                       std::size_t end_changed);
+
+    [[nodiscard]] auto num_representatives() const noexcept -> std::size_t
+    {
+        return representatives_.size();
+    }
+
+    void draw_points(float point_size, glm::vec4 color)
+    {
+        mesh_.draw_points(point_size, color);
+    }
+
+private:
+    static constexpr auto no_cell = std::numeric_limits<std::uint32_t>::max();
+
+    [[nodiscard]] auto cell_of(glm::vec2 point) const noexcept
+        -> std::uint32_t;
+
+    void add_point(glm::vec2 point, std::uint32_t cell);
+    void remove_point(std::uint32_t cell);
+
+    render::DynamicMesh2d mesh_;
+    glm::ivec2 grid_size_ = {};
+
+    // Cell of every point, no_cell if it is outside the view
+    std::vector<std::uint32_t> point_cells_;
+    std::vector<std::uint32_t> cell_counts_;
+
+    // Index of the representative of every occupied cell and the cell of
+    // every representative, to remove representatives by swapping them with
+    // the last one
+    std::vector<std::uint32_t> cell_representatives_;
+    std::vector<std::uint32_t> representative_cells_;
+
+    std::vector<glm::vec2> representatives_;
+};
+
+} // namespace pa093::visualization
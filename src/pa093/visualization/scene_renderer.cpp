@@ -0,0 +1,213 @@
+#include <pa093/visualization/scene_renderer.hpp>
+
+#include <span>
+
+#include <glm/gtc/type_ptr.hpp>
+#include <glpp/draw.hpp>
+
+#include <pa093/profiling/profiler.hpp>
+
+namespace pa093::visualization
+{
+
+namespace
+{
+
+[[nodiscard]] auto
+geometry_layer(scene::SceneGeometry const& geometry, std::size_t const layer)
+    -> scene::GeometryLayer const&
+{
+    using Layer = SceneRenderer::Layer;
+
+    switch (static_cast<Layer>(layer))
+    {
+        case Layer::polygon:
+            break;
+        case Layer::voronoi:
+            return geometry.voronoi;
+        case Layer::graph:
+            return geometry.graph;
+        case Layer::triangles:
+            return geometry.triangles;
+        case Layer::alpha_shape_boundary:
+            return geometry.alpha_shape_boundary;
+    }
+
+    return geometry.polygon;
+}
+
+} // namespace
+
+SceneRenderer::SceneRenderer(render::ShaderCache& shader_cache,
+                             Colors const& colors)
+    : program_{ shader_cache[program_config_path] }
+    , layer_location_{ program_.uniform_location("layer").value() }
+{
+    {
+        auto const program_use = render::ScopedUse{ program_ };
+        glUniform4fv(program_.uniform_location("colors").value(),
+                     static_cast<GLsizei>(layer_count),
+                     glm::value_ptr(colors.front()));
+    }
+
+    auto const vao_bind = glpp::ScopedBind{ vertex_array_ };
+    vertex_buffer_.bind_attribute(
+        static_cast<GLuint>(program_.attribute_location("pos").value()), 2);
+    element_buffer_.bind_elements();
+}
+
+void
+SceneRenderer::set_geometry(scene::SceneGeometry const& geometry)
+{
+    PA093_PROFILE_SCOPE("Upload scene");
+
+    upload_vertices(geometry);
+    upload_indices(geometry);
+}
+
+void
+SceneRenderer::draw()
+{
+    auto const program_use = render::ScopedUse{ program_ };
+    auto const vao_bind = glpp::ScopedBind{ vertex_array_ };
+
+    glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
+    draw_layer(Layer::triangles, GL_TRIANGLES);
+    glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+
+    draw_layer(Layer::voronoi, GL_LINES, static_cast<GLint>(num_points_));
+    draw_layer(Layer::alpha_shape_boundary, GL_LINES);
+    draw_layer(Layer::graph, GL_LINES);
+}
+
+void
+SceneRenderer::draw_polygon(float const point_size)
+{
+    auto const program_use = render::ScopedUse{ program_ };
+    auto const vao_bind = glpp::ScopedBind{ vertex_array_ };
+
+    draw_layer(Layer::polygon, GL_LINE_LOOP);
+    glPointSize(point_size);
+    draw_layer(Layer::polygon, GL_POINTS);
+    glPointSize(1.0f);
+}
+
+void
+SceneRenderer::upload_vertices(scene::SceneGeometry const& geometry)
+{
+    auto const& points = geometry.points;
+    auto const& voronoi_vertices = geometry.voronoi_vertices;
+
+    if (points.version == points_version_ and
+        voronoi_vertices.version == voronoi_vertices_version_)
+    {
+        return;
+    }
+
+    auto const voronoi_offset = points.points.size() * sizeof(glm::vec2);
+    auto const voronoi_bytes =
+        std::as_bytes(std::span{ voronoi_vertices.points });
+
+    if (points.version == points_version_ and
+        voronoi_offset + voronoi_bytes.size() <= vertex_buffer_.capacity())
+    {
+        vertex_buffer_.update(voronoi_offset, voronoi_bytes);
+    }
+    else
+    {
+        vertices_.assign(points.points.begin(), points.points.end());
+        vertices_.insert(vertices_.end(),
+                         voronoi_vertices.points.begin(),
+                         voronoi_vertices.points.end());
+        vertex_buffer_.assign(std::as_bytes(std::span{ vertices_ }));
+    }
+
+    points_version_ = points.version;
+    voronoi_vertices_version_ = voronoi_vertices.version;
+    num_points_ = points.points.size();
+}
+
+void
+SceneRenderer::upload_indices(scene::SceneGeometry const& geometry)
+{
+    auto first_changed = std::size_t{ 0u };
+    while (first_changed < layer_count and
+           layers_[first_changed].version ==
+               geometry_layer(geometry, first_changed).version)
+    {
+        ++first_changed;
+    }
+
+    if (first_changed == layer_count)
+    {
+        return;
+    }
+
+    // Indices of the layers in front stay in place, unless the buffer has
+    // to grow
+    auto const offset_of = [&](std::size_t const layer)
+    {
+        return layer == 0u
+                   ? std::size_t{ 0u }
+                   : layers_[layer - 1u].first + layers_[layer - 1u].count;
+    };
+
+    auto size = offset_of(first_changed);
+    for (auto i = first_changed; i < layer_count; ++i)
+    {
+        size += geometry_layer(geometry, i).indices.size();
+    }
+    if (size * sizeof(index_type) > element_buffer_.capacity())
+    {
+        first_changed = 0u;
+    }
+
+    auto const first = offset_of(first_changed);
+
+    indices_.clear();
+    for (auto i = first_changed; i < layer_count; ++i)
+    {
+        auto const& layer = geometry_layer(geometry, i);
+
+        layers_[i] = {
+            .version = layer.version,
+            .first = first + indices_.size(),
+            .count = layer.indices.size(),
+        };
+        indices_.insert(
+            indices_.end(), layer.indices.begin(), layer.indices.end());
+    }
+
+    auto const bytes = std::as_bytes(std::span{ indices_ });
+    if (first == 0u)
+    {
+        element_buffer_.assign(bytes);
+    }
+    else
+    {
+        element_buffer_.update(first * sizeof(index_type), bytes);
+    }
+}
+
+void
+SceneRenderer::draw_layer(Layer const layer,
+                          GLenum const mode,
+                          GLint const base_vertex)
+{
+    auto const& range = layers_[static_cast<std::size_t>(layer)];
+
+    if (range.count == 0u)
+    {
+        return;
+    }
+
+    glUniform1i(layer_location_, static_cast<GLint>(layer));
+    glDrawElementsBaseVertex(
+        mode,
+        static_cast<GLsizei>(range.count),
+        GL_UNSIGNED_INT,
+        reinterpret_cast<void const*>(range.first * sizeof(index_type)),
+        base_vertex);
+}
+
+} // namespace pa093::visualization
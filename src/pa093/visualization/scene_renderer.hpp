@@ -0,0 +1,103 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glpp/vertex_array.hpp>
+
+#include <pa093/render/shader_cache.hpp>
+#include <pa093/render/shader_program.hpp>
+#include <pa093/render/streaming_buffer.hpp>
+#include <pa093/scene/scene_geometry.hpp>
+
+namespace pa093::visualization
+{
+
+/**
+ * Draws the layers of a scene geometry with one program and vertex array.
+ *
+ * The vertex buffer holds the unique scene points followed by the Voronoi
+ * vertices, and the element buffer the indices of all layers back to back,
+ * so each layer is a single indexed draw. Layer colors come from a uniform
+ * table, selected by the layer index of the draw.
+ */
+class SceneRenderer
+{
+public:
+    /**
+     * Also the order of the layers in the element buffer, from the least to
+     * the most frequently changed by settings
+     */
+    enum class Layer
+    {
+        polygon,
+        voronoi,
+        graph,
+        triangles,
+        alpha_shape_boundary,
+    };
+
+    /**
+     * Must match the size of the color table in the fragment shader
+     */
+    static constexpr auto layer_count = std::size_t{ 5u };
+
+    using Colors = std::array<glm::vec4, layer_count>;
+
+    SceneRenderer(render::ShaderCache& shader_cache, Colors const& colors);
+
+    /**
+     * Uploads the layers whose version differs from the uploaded one. Layers
+     * in front of the first changed one keep their place in the element
+     * buffer and are not uploaded again.
+     */
+    void set_geometry(scene::SceneGeometry const& geometry);
+
+    /**
+     * Draws all layers except the polygon
+     */
+    void draw();
+
+    /**
+     * Draws the polygon outline and its vertices
+     */
+    void draw_polygon(float point_size);
+
+private:
+    using index_type = std::uint32_t;
+
+    static constexpr auto program_config_path =
+        "data/shader/scene_program.json";
+
+    struct LayerRange
+    {
+        std::uint64_t version = 0u;
+        std::size_t first = 0u;
+        std::size_t count = 0u;
+    };
+
+    render::ShaderProgram const& program_;
+    GLint layer_location_;
+    glpp::VertexArray vertex_array_;
+    render::StreamingBuffer vertex_buffer_;
+    render::StreamingBuffer element_buffer_;
+    std::uint64_t points_version_ = 0u;
+    std::uint64_t voronoi_vertices_version_ = 0u;
+    std::size_t num_points_ = 0u;
+    std::array<LayerRange, layer_count> layers_ = {};
+
+    // Staging for uploads of several arrays at once
+    std::vector<glm::vec2> vertices_;
+    std::vector<index_type> indices_;
+
+    void upload_vertices(scene::SceneGeometry const& geometry);
+
+    void upload_indices(scene::SceneGeometry const& geometry);
+
+    void draw_layer(Layer layer, GLenum mode, GLint base_vertex = 0);
+};
+
+} // namespace pa093::visualization